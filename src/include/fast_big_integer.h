@@ -6,9 +6,24 @@
 #include <compare> // use for C++ 20 spaceship
 #include <future> // use for std::future
 #include <random> // use for generate random data
+#include <algorithm> // use for std::binary_search
+#include <span> // use for std::span
+#include <cmath> // use for std::lgamma
+#include <bit> // use for std::countl_zero
+#include <cstring> // use for std::memcpy
+#include <memory> // use for std::shared_ptr
+#include <mutex> // use for std::mutex
+#include <charconv> // use for std::to_chars_result and std::from_chars_result
+#include <fstream> // use for std::ifstream and std::ofstream
+#include <ostream> // use for std::ostream
+#include <functional> // use for std::function
+#include <string_view> // use for std::string_view
+#include <cctype> // use for std::toupper
+#include <atomic> // use for std::atomic
 
 #include "modules/hpc/thread_pool.h" // use for thread pool
 #include "modules/converter/bbc.h" // use for big base converters
+#include "modules/primes/small_primes.h" // use for small primes table
 #include <emmintrin.h> // use for sse2
 
 namespace numbers
@@ -23,11 +38,128 @@ namespace numbers
 	 */
 	typedef char sbyte;
 
+	class fast_big_integer;
+
+	/**
+	 * \brief is a non-owning read only view of little endian bytes of large positive integer,
+	 * bytes must live longer then view
+	 */
+	class fast_big_integer_view
+	{
+		const byte* data_ = nullptr;
+		size_t size_ = 0;
+
+		/**
+		 * \return -1 if a is less then b, 0 if they are equal, 1 if a is greater then b
+		 */
+		static sbyte compare(fast_big_integer_view a, fast_big_integer_view b);
+
+	public:
+		/**
+		 * \brief init view of zero
+		 */
+		fast_big_integer_view() = default;
+		/**
+		 * \param data little endian bytes of number
+		 * \param size bytes count (zero bytes at the end are skipped)
+		 */
+		fast_big_integer_view(const byte* data, const size_t size) : data_(data), size_(size)
+		{
+			while (this->size_ != 0 && this->data_[this->size_ - 1] == 0)
+				this->size_--;
+		}
+		/**
+		 * \param bytes little endian bytes of number (zero bytes at the end are skipped)
+		 */
+		explicit fast_big_integer_view(const std::span<const std::byte> bytes)
+			: fast_big_integer_view(reinterpret_cast<const byte*>(bytes.data()), bytes.size()) {}
+
+		/**
+		 * \return little endian bytes without zero bytes at the end
+		 */
+		[[nodiscard]] const byte* data() const
+		{
+			return this->data_;
+		}
+		/**
+		 * \return bytes count
+		 */
+		[[nodiscard]] size_t size() const
+		{
+			return this->size_;
+		}
+		/**
+		 * \return if number is zero -> true, else -> false
+		 */
+		[[nodiscard]] bool is_zero() const
+		{
+			return this->size_ == 0;
+		}
+		/**
+		 * \return if number is one -> true, else -> false
+		 */
+		[[nodiscard]] bool is_one() const
+		{
+			return this->size_ == 1 && this->data_[0] == 1;
+		}
+		/**
+		 * \return if number is odd -> true, else -> false
+		 */
+		[[nodiscard]] bool is_odd() const
+		{
+			return this->size_ != 0 && (this->data_[0] & 1) != 0;
+		}
+		/**
+		 * \return count of significant bits in number (zero for zero)
+		 */
+		[[nodiscard]] size_t bit_length() const
+		{
+			if (this->is_zero())
+				return 0;
+
+			return ((this->size_ - 1) << 3) + std::bit_width(this->data_[this->size_ - 1]);
+		}
+		/**
+		 * \return hash of bytes, equal numbers have equal hashes
+		 */
+		[[nodiscard]] size_t hash() const
+		{
+			return std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(this->data_), this->size_));
+		}
+
+		/**
+		 * \return owning copy of number
+		 */
+		[[nodiscard]] fast_big_integer to_number() const;
+		/**
+		 * \brief digits are written by owning number, copy of bytes is cheap relative to conversion
+		 * \return dec string view of number
+		 */
+		[[nodiscard]] std::string to_string() const;
+		/**
+		 * \brief write digits by std::to_chars conventions as fast_big_integer::to_chars
+		 * \param first begin of buffer
+		 * \param last end of buffer
+		 * \param base radix (from 2 to 36)
+		 * \return pointer after the last written char, or last and std::errc::value_too_large when buffer is too small
+		 */
+		std::to_chars_result to_chars(char* first, char* last, int base = 10) const;
+
+		friend std::strong_ordering operator <=> (fast_big_integer_view a, fast_big_integer_view b);
+		friend bool operator == (fast_big_integer_view a, fast_big_integer_view b);
+
+		friend fast_big_integer operator & (fast_big_integer_view a, fast_big_integer_view b);
+		friend fast_big_integer operator | (fast_big_integer_view a, fast_big_integer_view b);
+		friend fast_big_integer operator ^ (fast_big_integer_view a, fast_big_integer_view b);
+	};
+
 	/**
 	 * \brief is a large positive integer
 	 */
 	class fast_big_integer
 	{
+		friend class fast_big_integer_view;
+
 		/**
 		 * \brief this is the set of bytes that make up the number
 		 */
@@ -132,10 +264,10 @@ namespace numbers
 
 			return 0;
 		}
-		static sbyte compare_optimized(const fast_big_integer& a, const fast_big_integer& b)
+		static sbyte compare_optimized(const fast_big_integer_view a, const fast_big_integer_view b)
 		{
-			const size_t a_size = a.bytes_.size();
-			const size_t b_size = b.bytes_.size();
+			const size_t a_size = a.size();
+			const size_t b_size = b.size();
 
 			if (a_size < b_size)
 				return -1;
@@ -151,19 +283,22 @@ namespace numbers
 
 			for (size_t i = a_size - 1; i != a_size - rem_count - 1; i--)
 			{
-				if (a.bytes_[i] > b.bytes_[i])
+				if (a.data()[i] > b.data()[i])
 					return 1;
-				if (a.bytes_[i] < b.bytes_[i])
+				if (a.data()[i] < b.data()[i])
 					return -1;
 			}
 
 			if (others_count == 0)
 				return 0;
 			
+			// sse2 has only signed bytes comparison, so flip sign bits
+			const __m128i sign_bits = _mm_set1_epi8(static_cast<char>(0x80));
+
 			for(size_t i = others_count - simd_bytes_count;;)
 			{
-				const __m128i a_data = _mm_load_si128((__m128i*)&a.bytes_[i]);
-				const __m128i b_data = _mm_load_si128((__m128i*)&b.bytes_[i]);
+				const __m128i a_data = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a.data() + i)), sign_bits);
+				const __m128i b_data = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(b.data() + i)), sign_bits);
 
 				const __m128i a_is_greater = _mm_cmpgt_epi8(a_data, b_data);
 				const __m128i a_is_letter = _mm_cmplt_epi8(a_data, b_data);
@@ -190,7 +325,7 @@ namespace numbers
 		 * \param destination first number for sum (store the result)
 		 * \param source second number for sum
 		 */
-		static void add_classic(fast_big_integer& destination, const fast_big_integer& source)
+		static void add_classic(fast_big_integer& destination, const fast_big_integer_view source)
 		{
 			if (destination.is_zero() && source.is_zero())
 				return;
@@ -198,19 +333,19 @@ namespace numbers
 				return;
 			if (destination.is_zero())
 			{
-				destination = source;
+				destination.bytes_.assign(source.data(), source.data() + source.size());
 				return;
 			}
 
-			if (destination.bytes_.size() < source.bytes_.size())
-				destination.bytes_.resize(source.bytes_.size());
+			if (destination.bytes_.size() < source.size())
+				destination.bytes_.resize(source.size());
 
 			byte carry = 0;
 
 			auto destination_data = destination.bytes_.begin();
-			auto source_data = source.bytes_.begin();
+			auto source_data = source.data();
 
-			auto counter = source.bytes_.size();
+			auto counter = source.size();
 			auto addition_iterations = destination.bytes_.size() - counter;
 
 			while (counter-- != 0)
@@ -235,11 +370,11 @@ namespace numbers
 		 * \param destination first number (store the result)
 		 * \param source second number
 		 */
-		static void sub_classic(fast_big_integer& destination, const fast_big_integer& source)
+		static void sub_classic(fast_big_integer& destination, const fast_big_integer_view source)
 		{
-			for (size_t i = 0; i < source.bytes_.size(); i++)
+			for (size_t i = 0; i < source.size(); i++)
 			{
-				if (destination.bytes_[i] < source.bytes_[i])
+				if (destination.bytes_[i] < source.data()[i])
 				{
 					auto data = destination.bytes_.begin() + i;
 
@@ -249,7 +384,7 @@ namespace numbers
 					*data -= 1;
 				}
 
-				destination.bytes_[i] -= source.bytes_[i];
+				destination.bytes_[i] -= source.data()[i];
 			}
 
 			fast_big_integer::clear_zero_bytes(destination);
@@ -266,6 +401,19 @@ namespace numbers
 			if (divisor.is_zero())
 				throw std::invalid_argument("divisor is zero");
 
+			if (dividend < divisor)
+			{
+				remainder = dividend;
+				quotient.set_zero();
+				return;
+			}
+			if (divisor.is_one())
+			{
+				quotient = dividend;
+				remainder.set_zero();
+				return;
+			}
+
 			const fast_big_integer _dividend = dividend, _divisor = divisor;
 			const size_t k = _dividend.num_bits() + _divisor.num_bits();
 
@@ -282,1258 +430,4754 @@ namespace numbers
 
 			quotient = _dividend * x >> k;
 
-			if (_dividend - (quotient * _divisor) >= _divisor)
-				++quotient;
+			// approximation may be off by one in both directions
+			fast_big_integer product = quotient * _divisor;
+			while (product > _dividend)
+			{
+				--quotient;
+				product.sub(_divisor);
+			}
 
-			remainder = _dividend - (quotient * divisor);
+			remainder = _dividend - product;
+			while (remainder >= _divisor)
+			{
+				++quotient;
+				remainder.sub(_divisor);
+			}
 		}
 
 		/**
-		 * \brief remove all back bytes, which equal to zero
-		 * \param bytes to clear
+		 * \param bytes number bytes
+		 * \return number as 32 bits words
 		 */
-		static void clear_zero_bytes(std::vector<byte>& bytes)
+		static std::vector<uint32_t> bytes_to_words(const fast_big_integer_view bytes)
 		{
-			while (!bytes.empty())
-			{
-				if (bytes.back() != 0)
-					break;
+			constexpr size_t word_size = sizeof(uint32_t);
+			std::vector<uint32_t> words((bytes.size() + word_size - 1) / word_size);
 
-				bytes.pop_back();
-			}
+			for (size_t i = 0; i < bytes.size(); i++)
+				words[i / word_size] |= static_cast<uint32_t>(bytes.data()[i]) << (i % word_size * 8);
+
+			return words;
 		}
 		/**
-		 * \brief remove all back bytes, which equal to zero
-		 * \param number to clear
+		 * \param words number as 32 bits words
+		 * \return number bytes (without zero bytes at the end)
 		 */
-		static void clear_zero_bytes(fast_big_integer& number)
+		static std::vector<byte> words_to_bytes(const std::vector<uint32_t>& words)
 		{
-			fast_big_integer::clear_zero_bytes(number.bytes_);
+			constexpr size_t word_size = sizeof(uint32_t);
+			std::vector<byte> bytes(words.size() * word_size);
+
+			for (size_t i = 0; i < bytes.size(); i++)
+				bytes[i] = static_cast<byte>(words[i / word_size] >> (i % word_size * 8));
+
+			fast_big_integer::clear_zero_bytes(bytes);
+
+			return bytes;
 		}
+		/**
+		 * \brief perform schoolbook multiplication by 32 bits words
+		 * \param a first multiplier words
+		 * \param a_size first multiplier words count
+		 * \param b second multiplier words
+		 * \param b_size second multiplier words count
+		 * \param result product words (a_size + b_size words, filled by zeros)
+		 */
+		static void mul_words_schoolbook(const uint32_t* a, const size_t a_size, const uint32_t* b, const size_t b_size, uint32_t* result)
+		{
+			for (size_t i = 0; i < a_size; i++)
+			{
+				const uint64_t multiplier = a[i];
+				uint64_t carry = 0;
 
-		static std::vector<byte> create_from_hex_string(const std::string& hex_string)
-		{
-			struct hex_table {
-				long long tab[128];
-				constexpr hex_table() : tab{} {
-					tab['1'] = 1;
-					tab['2'] = 2;
-					tab['3'] = 3;
-					tab['4'] = 4;
-					tab['5'] = 5;
-					tab['6'] = 6;
-					tab['7'] = 7;
-					tab['8'] = 8;
-					tab['9'] = 9;
-					tab['a'] = 10;
-					tab['A'] = 10;
-					tab['b'] = 11;
-					tab['B'] = 11;
-					tab['c'] = 12;
-					tab['C'] = 12;
-					tab['d'] = 13;
-					tab['D'] = 13;
-					tab['e'] = 14;
-					tab['E'] = 14;
-					tab['f'] = 15;
-					tab['F'] = 15;
+				for (size_t j = 0; j < b_size; j++)
+				{
+					const uint64_t value = multiplier * b[j] + result[i + j] + carry;
+					result[i + j] = static_cast<uint32_t>(value);
+					carry = value >> 32;
 				}
 
-				[[nodiscard]] constexpr int16_t hex_to_int(const char number) const
+				result[i + b_size] = static_cast<uint32_t>(carry);
+			}
+		}
+		/**
+		 * \brief perform schoolbook squaring by 32 bits words, each cross product
+		 * is calculated once and doubled, so it is about two times faster then multiplication
+		 * \param a number words
+		 * \param size number words count
+		 * \param result square words (2 * size words, filled by zeros)
+		 */
+		static void square_words_schoolbook(const uint32_t* a, const size_t size, uint32_t* result)
+		{
+			// cross products a[i] * a[j], i < j
+			for (size_t i = 0; i < size; i++)
+			{
+				const uint64_t multiplier = a[i];
+				uint64_t carry = 0;
+
+				for (size_t j = i + 1; j < size; j++)
 				{
-					return static_cast<int16_t>(tab[static_cast<int16_t>(number)]);
+					const uint64_t value = multiplier * a[j] + result[i + j] + carry;
+					result[i + j] = static_cast<uint32_t>(value);
+					carry = value >> 32;
 				}
-				
-			} constexpr hex_table;
 
-			std::vector<byte> bytes; bytes.reserve(hex_string.size() / 2 + hex_string.size() % 2);
+				result[i + size] = static_cast<uint32_t>(carry);
+			}
 
-			for (size_t i = (hex_string.length() >> 1) - 1; i != std::numeric_limits<size_t>::max(); i--)
+			// double cross products
+			uint32_t shifted_bit = 0;
+			for (size_t i = 0; i < 2 * size; i++)
 			{
-				const byte b1 = static_cast<byte>(hex_table.hex_to_int(hex_string[i * 2])) << 4;
-				const byte b2 = static_cast<byte>(hex_table.hex_to_int(hex_string[i * 2 + 1]));
-				bytes.push_back(b1 + b2);
+				const uint32_t next_shifted_bit = result[i] >> 31;
+				result[i] = result[i] << 1 | shifted_bit;
+				shifted_bit = next_shifted_bit;
 			}
 
-			return bytes;
+			// add squares a[i] * a[i]
+			uint64_t carry = 0;
+			for (size_t i = 0; i < size; i++)
+			{
+				const uint64_t square = static_cast<uint64_t>(a[i]) * a[i];
+
+				uint64_t value = result[2 * i] + (square & 0xFFFFFFFF) + carry;
+				result[2 * i] = static_cast<uint32_t>(value);
+
+				value = result[2 * i + 1] + (square >> 32) + (value >> 32);
+				result[2 * i + 1] = static_cast<uint32_t>(value);
+				carry = value >> 32;
+			}
 		}
-		static std::string create_hex_string(const std::vector<byte>& bytes)
+		/**
+		 * \brief add words of x to words of destination
+		 * \param destination destination words (sum must fit in destination_size words)
+		 * \param destination_size destination words count
+		 * \param x added words
+		 * \param x_size added words count (not greater then destination_size)
+		 */
+		static void add_words(uint32_t* destination, const size_t destination_size, const uint32_t* x, const size_t x_size)
 		{
-			if (bytes.empty())
-				return "00";
+			uint64_t carry = 0;
+			size_t i = 0;
 
-			std::stringstream hex_view;
+			for (; i < x_size; i++)
+			{
+				const uint64_t value = static_cast<uint64_t>(destination[i]) + x[i] + carry;
+				destination[i] = static_cast<uint32_t>(value);
+				carry = value >> 32;
+			}
 
-			for (size_t i = 0; i < bytes.size(); i++)
+			for (; carry != 0 && i < destination_size; i++)
 			{
-				if (bytes[bytes.size() - i - 1] < 16)
-					hex_view << '0';
+				const uint64_t value = static_cast<uint64_t>(destination[i]) + carry;
+				destination[i] = static_cast<uint32_t>(value);
+				carry = value >> 32;
+			}
+		}
+		/**
+		 * \brief subtract words of x from words of destination
+		 * \param destination destination words (not less then x)
+		 * \param destination_size destination words count
+		 * \param x subtracted words
+		 * \param x_size subtracted words count (not greater then destination_size)
+		 */
+		static void sub_words(uint32_t* destination, const size_t destination_size, const uint32_t* x, const size_t x_size)
+		{
+			uint64_t borrow = 0;
+			size_t i = 0;
 
-				hex_view << std::uppercase << std::hex << static_cast<uint16_t>(bytes[bytes.size() - 1 - i]);
+			for (; i < x_size; i++)
+			{
+				const uint64_t value = static_cast<uint64_t>(destination[i]) - x[i] - borrow;
+				destination[i] = static_cast<uint32_t>(value);
+				borrow = value >> 63;
 			}
 
-			return hex_view.str();
+			for (; borrow != 0 && i < destination_size; i++)
+			{
+				const uint64_t value = static_cast<uint64_t>(destination[i]) - borrow;
+				destination[i] = static_cast<uint32_t>(value);
+				borrow = value >> 63;
+			}
 		}
-		
-	public:
-
 		/**
-		 * \brief contains all extensions methods to working
+		 * \brief perform Karatsuba multiplication by 32 bits words, short operands are multiplied
+		 * by schoolbook, long unbalanced operands are multiplied by chunks of size of shorter operand,
+		 * when a and b are same words, squares are calculated in recursion
+		 * \param a first multiplier words
+		 * \param a_size first multiplier words count
+		 * \param b second multiplier words
+		 * \param b_size second multiplier words count
+		 * \param result product words (a_size + b_size words, filled by zeros)
 		 */
-		struct extensions
+		static void mul_words_karatsuba(const uint32_t* a, size_t a_size, const uint32_t* b, size_t b_size, uint32_t* result)
 		{
-			/**
-			 * \param a first number
-			 * \param b second number
-			 * \return largest of the numbers
-			 */
-			static fast_big_integer max(const fast_big_integer& a, const fast_big_integer& b)
+			// Karatsuba is faster then schoolbook from this words count
+			constexpr size_t karatsuba_threshold = 32;
+
+			const bool is_square = a == b && a_size == b_size;
+
+			if (a_size < b_size)
 			{
-				return a > b ? a : b;
+				std::swap(a, b);
+				std::swap(a_size, b_size);
 			}
-			/**
-			 * \param a first number
-			 * \param b second number
-			 * \return smallest of numbers
-			 */
-			static fast_big_integer min(const fast_big_integer& a, const fast_big_integer& b)
+
+			if (b_size < karatsuba_threshold)
 			{
-				return a < b ? a : b;
+				if (is_square)
+					fast_big_integer::square_words_schoolbook(a, a_size, result);
+				else
+					fast_big_integer::mul_words_schoolbook(a, a_size, b, b_size, result);
+
+				return;
 			}
 
-			/**
-			 * \param a fist number
-			 * \param b second number
-			 * \return greatest common divisor number
-			 */
-			static fast_big_integer gcd(const fast_big_integer& a, const fast_big_integer& b)
+			if (a_size >= 2 * b_size)
 			{
-				fast_big_integer tmp_a = a, tmp_b = b;
+				std::vector<uint32_t> chunk_product(2 * b_size);
 
-				while (tmp_b.is_not_zero())
+				for (size_t offset = 0; offset < a_size; offset += b_size)
 				{
-					fast_big_integer rem, q;
-					fast_big_integer::div_classic(tmp_a, tmp_b, q, rem);
+					const size_t chunk_size = std::min(b_size, a_size - offset);
 
-					tmp_a = tmp_b;
-					tmp_b = rem;
+					std::fill(chunk_product.begin(), chunk_product.end(), 0);
+					fast_big_integer::mul_words_karatsuba(a + offset, chunk_size, b, b_size, chunk_product.data());
+					fast_big_integer::add_words(result + offset, a_size + b_size - offset, chunk_product.data(), chunk_size + b_size);
 				}
 
-				return tmp_a;
-			}
-			/**
-			 * \param a fist number
-			 * \param b second number
-			 * \return least common multiple number
-			 */
-			static fast_big_integer lcm(const fast_big_integer& a, const fast_big_integer& b)
-			{
-				return (a * b / fast_big_integer::extensions::gcd(a, b));
+				return;
 			}
 
-			/**
-			 * \param max_byte_count max random byte count
-			 * \return random whole number
-			 */
-			static fast_big_integer random(uint32_t max_byte_count = 1000u)
-			{
-				if (max_byte_count == 0)
-					return fast_big_integer::zero();
+			// a = a1 * B^h + a0, b = b1 * B^h + b0, b1 is not empty, because b_size > a_size / 2
+			const size_t h = a_size / 2;
+			const size_t a1_size = a_size - h, b1_size = b_size - h;
 
-				std::mt19937 rnd(std::random_device().operator()());
-				const std::uniform_int_distribution<std::mt19937::result_type> rand_size(0, max_byte_count);
+			// z0 = a0 * b0, z2 = a1 * b1
+			fast_big_integer::mul_words_karatsuba(a, h, is_square ? a : b, h, result);
+			fast_big_integer::mul_words_karatsuba(a + h, a1_size, is_square ? a + h : b + h, b1_size, result + 2 * h);
 
-				const uint32_t size = rand_size(rnd);
-				if (size == 0) return fast_big_integer::zero();
+			// z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+			std::vector<uint32_t> a_sum(a1_size + 1), b_sum(std::max(h, b1_size) + 1);
 
-				std::vector<byte> random_bytes(size);
-				const std::uniform_int_distribution<std::mt19937::result_type> rand_byte(0, 255);
+			std::copy(a + h, a + a_size, a_sum.begin());
+			fast_big_integer::add_words(a_sum.data(), a_sum.size(), a, h);
 
-				for (size_t i = 0; i < size; i++)
-					random_bytes[i] = static_cast<byte>(rand_byte(rnd));
+			std::copy(b + h, b + b_size, b_sum.begin());
+			fast_big_integer::add_words(b_sum.data(), b_sum.size(), b, h);
 
-				fast_big_integer::clear_zero_bytes(random_bytes);
+			std::vector<uint32_t> z1(a_sum.size() + b_sum.size());
+			if (is_square)
+				fast_big_integer::mul_words_karatsuba(a_sum.data(), a_sum.size(), a_sum.data(), a_sum.size(), z1.data());
+			else
+				fast_big_integer::mul_words_karatsuba(a_sum.data(), a_sum.size(), b_sum.data(), b_sum.size(), z1.data());
 
-				return random_bytes;
-			}
-			static fast_big_integer random_sizeof(uint32_t byte_count)
-			{
-				const uint32_t size = byte_count;
-				if (size == 0) return fast_big_integer::zero();
-				
-				std::mt19937 rnd(std::random_device().operator()());
-				const std::uniform_int_distribution<std::mt19937::result_type> rand_byte(1, 254);
+			fast_big_integer::sub_words(z1.data(), z1.size(), result, 2 * h);
+			fast_big_integer::sub_words(z1.data(), z1.size(), result + 2 * h, a1_size + b1_size);
 
-				std::vector<byte> random_bytes(size);
+			// z1 < B^(a_size + b_size - h), high words are zeros
+			size_t z1_size = z1.size();
+			while (z1_size != 0 && z1[z1_size - 1] == 0)
+				z1_size--;
 
-				for (size_t i = 0; i < size; i++)
-					random_bytes[i] = static_cast<byte>(rand_byte(rnd));
+			fast_big_integer::add_words(result + h, a_size + b_size - h, z1.data(), z1_size);
+		}
+		/**
+		 * \param a first multiplier bytes
+		 * \param b second multiplier bytes
+		 * \return product bytes
+		 */
+		static std::vector<byte> mul_words(const fast_big_integer_view a, const fast_big_integer_view b)
+		{
+			const std::vector<uint32_t> a_words = fast_big_integer::bytes_to_words(a);
+			const std::vector<uint32_t> b_words = fast_big_integer::bytes_to_words(b);
 
-				fast_big_integer::clear_zero_bytes(random_bytes);
+			std::vector<uint32_t> result_words(a_words.size() + b_words.size());
+			fast_big_integer::mul_words_karatsuba(a_words.data(), a_words.size(), b_words.data(), b_words.size(), result_words.data());
 
-				return random_bytes;
-			}
+			return fast_big_integer::words_to_bytes(result_words);
+		}
+		/**
+		 * \param a number bytes
+		 * \return square bytes
+		 */
+		static std::vector<byte> square_words(const fast_big_integer_view a)
+		{
+			const std::vector<uint32_t> words = fast_big_integer::bytes_to_words(a);
 
-			/**
-			 * \param hex_string anything hex string
-			 * \return random whole number
-			 */
-			static fast_big_integer create_from_hex(std::string hex_string)
-			{
-				if (hex_string.empty())
-					return fast_big_integer::zero();
-				
-				if (hex_string.size() % 2 == 1)
-					hex_string.insert(0, 1, '0');
-				
-				return fast_big_integer::create_from_hex_string(hex_string);
-			}
+			std::vector<uint32_t> result_words(words.size() * 2);
+			fast_big_integer::mul_words_karatsuba(words.data(), words.size(), words.data(), words.size(), result_words.data());
 
-			static fast_big_integer pow(const fast_big_integer& n, const fast_big_integer& power)
-			{
-				return n.pow(power);
-			}
-			static fast_big_integer factorial(const fast_big_integer& n)
-			{
-				return n.factorial();
-			}
-			static fast_big_integer factorial_parallel(const fast_big_integer& n)
+			return fast_big_integer::words_to_bytes(result_words);
+		}
+
+		/**
+		 * \brief remove all back bytes, which equal to zero
+		 * \param bytes to clear
+		 */
+		static void clear_zero_bytes(std::vector<byte>& bytes)
+		{
+			while (!bytes.empty())
 			{
-				return n.factorial_parallel();
+				if (bytes.back() != 0)
+					break;
+
+				bytes.pop_back();
 			}
-			static fast_big_integer log_n(const fast_big_integer& x, size_t n)
-			{
-				return x.log_n(n);
-			}
-			static fast_big_integer log_2(const fast_big_integer& x)
-			{
-				return x.log_n(2);
-			}
-			static fast_big_integer sqrt(const fast_big_integer& n)
-			{
-				return n.sqrt();
-			}
-			static fast_big_integer is_power_of_two(const fast_big_integer& n)
-			{
-				return n.is_power_of_two();
-			}
-			static fast_big_integer pow2(size_t power)
-			{
-				if (power == 0)
-					return { 1 };
-				if (power == 1)
-					return { 2 };
-				
-				constexpr byte eight = 8; // eight bits in byte
-				const size_t byte_count = power / eight;
-				const size_t bits_shift_count = power - byte_count * eight;
-
-				std::vector<byte> bytes(byte_count + 1);
-				bytes.back() = 1 << bits_shift_count;
-
-				return bytes;
-			}
-
-		private:
-			extensions() = default;
-		};
-
-		/**
-		 * \brief init number to default value (is zero)
-		 */
-		fast_big_integer() = default;
+		}
 		/**
-		 * \brief init number from string
-		 * \param decimal_string number in dec format
+		 * \brief remove all back bytes, which equal to zero
+		 * \param number to clear
 		 */
-		fast_big_integer(const std::string& decimal_string)
+		static void clear_zero_bytes(fast_big_integer& number)
 		{
-			const converters::dec2hex_bbc d2h;
-			const std::string hex_str = d2h.convert(decimal_string);
-
-			this->bytes_ = fast_big_integer::create_from_hex_string(hex_str);
+			fast_big_integer::clear_zero_bytes(number.bytes_);
 		}
-		fast_big_integer(const char decimal_string[]) : fast_big_integer(std::string(decimal_string)) {}
+
 		/**
-		 * \brief init number from byte vector
-		 * \param bytes future number bytes
+		 * \param number dividend
+		 * \param divisor word divisor (not equal to zero)
+		 * \return remainder of division number by divisor
 		 */
-		fast_big_integer(std::vector<byte> bytes)
+		static uint32_t rem_word(const fast_big_integer& number, const uint32_t divisor)
 		{
-			fast_big_integer::clear_zero_bytes(bytes);
-			this->bytes_ = bytes;
+			const size_t size = number.bytes_.size();
+			const size_t head_size = size % sizeof(uint32_t);
+			uint64_t rem = 0;
+
+			// not full word at the top of number
+			for (size_t i = size - 1; i != size - head_size - 1; i--)
+				rem = ((rem << 8) | number.bytes_[i]) % divisor;
+
+			for (size_t i = size - head_size; i != 0; i -= sizeof(uint32_t))
+			{
+				const byte* data = &number.bytes_[i - sizeof(uint32_t)];
+				const uint64_t word = static_cast<uint64_t>(data[0]) | static_cast<uint64_t>(data[1]) << 8 |
+					static_cast<uint64_t>(data[2]) << 16 | static_cast<uint64_t>(data[3]) << 24;
+
+				rem = ((rem << 32) | word) % divisor;
+			}
+
+			return static_cast<uint32_t>(rem);
 		}
 		/**
-		 * \brief init number from byte array
-		 * \param bytes future number bytes
+		 * \param number any number (not equal to zero)
+		 * \return count of zero bits at the end of number
 		 */
-		fast_big_integer(const std::initializer_list<byte> bytes)
+		static size_t trailing_zero_bits(const fast_big_integer& number)
 		{
-			std::vector<byte> bts = bytes;
-			fast_big_integer::clear_zero_bytes(bts);
-			this->bytes_ = bts;
+			size_t count = 0;
+			size_t i = 0;
+
+			while (number.bytes_[i] == 0)
+			{
+				count += 8;
+				i++;
+			}
+
+			for (byte b = number.bytes_[i]; (b & 1) == 0; b >>= 1)
+				count++;
+
+			return count;
 		}
 		/**
-		 * \brief init number from int64_t value
-		 * \param number any number
-		 */
-		fast_big_integer(int64_t number) : bytes_(fast_big_integer::long_to_bytes(number)) {}
-		/**
-		 * \brief init number from uint64_t value
-		 * \param number any number
-		 */
-		fast_big_integer(uint64_t number) : bytes_(fast_big_integer::ulong_to_bytes(number)) {}
-		/**
-		 * \brief init number from int32_t value
 		 * \param number any number
+		 * \param bit_index index of lowest bit of window
+		 * \param width bits count in window (not greater then 32)
+		 * \return value of bits [bit_index, bit_index + width) of number
 		 */
-		fast_big_integer(int32_t number) : bytes_(fast_big_integer::int_to_bytes(number)) {}
-		~fast_big_integer()
+		static uint32_t bits_window(const fast_big_integer& number, const size_t bit_index, const size_t width)
 		{
-			this->bytes_.clear();
-		}
+			uint64_t window = 0;
 
-		/**
-		 * \return number with value "0"
-		 */
-		static fast_big_integer zero()
-		{
-			static fast_big_integer zero;
-			return zero;
+			// window is contained in five bytes from byte of lowest bit
+			const size_t first_byte = bit_index >> 3;
+			for (size_t i = 0; i < 5 && first_byte + i < number.bytes_.size(); i++)
+				window |= static_cast<uint64_t>(number.bytes_[first_byte + i]) << (i * 8);
+
+			return static_cast<uint32_t>(window >> (bit_index & 7) & ((static_cast<uint64_t>(1) << width) - 1));
 		}
+
 		/**
-		 * \return number with value "1"
+		 * \brief check eight chars at once (SWAR), each byte must be in ['0', '9']
+		 * \param chars eight chars
+		 * \return if all chars are decimal digits -> true, else -> false
 		 */
-		static fast_big_integer one()
+		static bool is_eight_digits(const char* chars)
 		{
-			static fast_big_integer one = { 1 };
-			return one;
+			uint64_t word;
+			std::memcpy(&word, chars, sizeof(word));
+
+			// byte - '0' borrows for bytes less then '0', byte + 0x46 carries to high bit for bytes greater then '9'
+			const uint64_t less_then_zero = word - 0x3030303030303030;
+			const uint64_t greater_then_nine = word + 0x4646464646464646;
+
+			return ((word | less_then_zero | greater_then_nine) & 0x8080808080808080) == 0;
 		}
 		/**
-		 * \return number with value "2"
+		 * \brief convert eight decimal digits at once (SWAR), pairs, quads and octets of digits
+		 * are combined by three multiplications
+		 * \param chars eight decimal digits, the most significant first
+		 * \return value of digits
 		 */
-		static fast_big_integer two()
+		static uint64_t parse_eight_digits(const char* chars)
 		{
-			static fast_big_integer two = { 2 };
-			return two;
+			uint64_t word;
+			std::memcpy(&word, chars, sizeof(word));
+
+			word = (word & 0x0F0F0F0F0F0F0F0F) * 2561 >> 8; // 10 * a + b
+			word = (word & 0x00FF00FF00FF00FF) * 6553601 >> 16; // 100 * ab + cd
+			return (word & 0x0000FFFF0000FFFF) * 42949672960001 >> 32; // 10000 * abcd + efgh
 		}
 		/**
-		 * \return number with value "3"
+		 * \param symbol any char
+		 * \return value of digit (letters of both cases are digits from 10 to 35), 36 for other chars
 		 */
-		static fast_big_integer three()
+		static uint32_t digit_value(const char symbol)
 		{
-			static fast_big_integer three = { 3 };
-			return three;
+			if (symbol >= '0' && symbol <= '9')
+				return static_cast<uint32_t>(symbol - '0');
+			if (symbol >= 'a' && symbol <= 'z')
+				return static_cast<uint32_t>(symbol - 'a' + 10);
+			if (symbol >= 'A' && symbol <= 'Z')
+				return static_cast<uint32_t>(symbol - 'A' + 10);
+
+			return 36;
 		}
-		
+		// conversions of this digits count and more are split between threads of pool (0 -> conversions are serial)
+		inline static std::atomic<size_t> parallel_conversion_digits_count = std::thread::hardware_concurrency() >= 2 ? 1 << 15 : 0;
+
 		/**
-		 * \return dec string view of number
+		 * \brief waits for all started jobs on every exit path, so jobs never outlive locals, which they reference
 		 */
-		[[nodiscard]] std::string to_string() const
+		struct pool_jobs_guard
 		{
-			const converters::hex2dec_bbc h2d;
+			hpc::thread_pool<fast_big_integer>& thread_pool;
+			std::vector<std::future<fast_big_integer>>& results;
 
-			const std::string hex_str = fast_big_integer::create_hex_string(this->bytes_);
-			const std::string dec_string = h2d.convert(hex_str);
+			~pool_jobs_guard()
+			{
+				for (std::future<fast_big_integer>& result : this->results)
+				{
+					if (!result.valid())
+						continue;
+
+					// exception of job is already propagated by other exit path
+					try
+					{
+						this->thread_pool.wait_and_help(result);
+					}
+					catch (...)
+					{
+					}
+				}
+			}
+		};
 
-			return dec_string;
-		}
-		/**
-		 * \return hex string view of number
-		 */
-		[[nodiscard]] std::string to_string_hex() const
-		{
-			return fast_big_integer::create_hex_string(this->bytes_);
-		}
 		/**
-		 * \return byte vector
+		 * \brief digits of power of two base are packed to bits directly, other digits are converted
+		 * to words by chunks of d digits, then chunks are combined by pairs with powers base^(d * 2^k),
+		 * so cost is about log(n) multiplications of full size, long numbers are split to the most
+		 * significant digits and the lowest d * 2^k digits, which are converted by thread pool
+		 * \param digits correct digits, the most significant first
+		 * \param size digits count (not equal to zero)
+		 * \param base radix (from 2 to 36)
+		 * \return number bytes
 		 */
-		[[nodiscard]] std::vector<byte> to_bytes() const
-		{
-			return this->bytes_;
-		}
-		[[nodiscard]] size_t try_to_size_t() const
+		static std::vector<byte> create_from_digits(const char* digits, const size_t size, const uint32_t base)
 		{
-			if (this->bytes_.size() > sizeof(size_t))
-				throw std::invalid_argument("number greater then max size_t value");
-			if (this->bytes_.empty())
-				return static_cast<size_t>(0);
-			
-			size_t value = 0;
-			for(size_t i = 0; i < this->bytes_.size(); i++)
+			if (std::has_single_bit(base))
 			{
-				value <<= 8;
-				value |= this->bytes_[this->bytes_.size() - i - 1];
-			}
+				const uint32_t digit_bits_count = static_cast<uint32_t>(std::countr_zero(base));
 
-			return value;
-		}
+				std::vector<byte> bytes;
+				bytes.reserve(size * digit_bits_count / 8 + 1);
 
-		/**
-		 * \brief perform AND operation
-		 * \param number operand
-		 * \return AND operation result between this and number
-		 */
-		fast_big_integer and (const fast_big_integer& number) const
-		{
-			const size_t result_size = std::min(this->bytes_.size(), number.bytes_.size());
-			std::vector<byte> result_bytes(result_size);
+				uint64_t buffer = 0;
+				uint32_t buffer_bits_count = 0;
 
-			for (size_t i = 0; i < result_size; i++)
-				result_bytes[i] = number.bytes_[i] & this->bytes_[i];
+				for (size_t i = size; i != 0; i--)
+				{
+					buffer |= static_cast<uint64_t>(fast_big_integer::digit_value(digits[i - 1])) << buffer_bits_count;
+					buffer_bits_count += digit_bits_count;
 
-			fast_big_integer::clear_zero_bytes(result_bytes);
+					for (; buffer_bits_count >= 8; buffer_bits_count -= 8, buffer >>= 8)
+						bytes.push_back(static_cast<byte>(buffer));
+				}
 
-			return result_bytes;
-		}
-		/**
-		 * \brief perform OR operation
-		 * \param number operand
-		 * \return OR operation result between this and number
-		 */
-		fast_big_integer or (const fast_big_integer & number) const
-		{
-			const size_t calculated_part_size = std::min(this->bytes_.size(), number.bytes_.size());
-			const size_t filled_part_size = std::max(this->bytes_.size(), number.bytes_.size()) - calculated_part_size;
-			auto& greater_number_bytes = this->bytes_.size() > number.bytes_.size() ? this->bytes_ : number.bytes_;
-			std::vector<byte> result_bytes(calculated_part_size + filled_part_size);
+				if (buffer_bits_count != 0)
+					bytes.push_back(static_cast<byte>(buffer));
 
-			for (size_t i = 0; i < calculated_part_size; i++)
-				result_bytes[i] = number.bytes_[i] | this->bytes_[i];
+				fast_big_integer::clear_zero_bytes(bytes);
 
-			for (size_t i = calculated_part_size; i < filled_part_size + calculated_part_size; i++)
-				result_bytes[i] = greater_number_bytes[i];
+				return bytes;
+			}
 
-			fast_big_integer::clear_zero_bytes(result_bytes);
+			constexpr size_t simd_width = 8;
+			const size_t chunk_digits_count = radix_powers_cache::digits_per_word(base);
 
-			return result_bytes;
-		}
-		/**
-		 * \brief perform XOR operation
-		 * \param number operand
-		 * \return XOR operation result between this and number
-		 */
-		fast_big_integer xor (const fast_big_integer& number) const
-		{
-			const size_t calculated_part_size = std::min(this->bytes_.size(), number.bytes_.size());
-			const size_t filled_part_size = std::max(this->bytes_.size(), number.bytes_.size()) - calculated_part_size;
-			auto& greater_number_bytes = this->bytes_.size() > number.bytes_.size() ? this->bytes_ : number.bytes_;
-			std::vector<byte> result_bytes(calculated_part_size + filled_part_size);
+			const size_t parallel_digits_count = fast_big_integer::parallel_conversion_digits_count.load(std::memory_order_relaxed);
 
-			for (size_t i = 0; i < calculated_part_size; i++)
-				result_bytes[i] = number.bytes_[i] ^ this->bytes_[i];
+			if (parallel_digits_count != 0 && size >= parallel_digits_count && size > chunk_digits_count)
+			{
+				// the lowest digits are the greatest group of d * 2^k digits, which is shorter then all digits
+				size_t level = 0;
+				while ((chunk_digits_count << (level + 1)) < size)
+					level++;
 
-			for (size_t i = calculated_part_size; i < filled_part_size + calculated_part_size; i++)
-				result_bytes[i] = greater_number_bytes[i];
+				const size_t low_size = chunk_digits_count << level;
 
-			fast_big_integer::clear_zero_bytes(result_bytes);
+				hpc::thread_pool<fast_big_integer>& thread_pool = hpc::thread_pool<fast_big_integer>::get_instance();
+				std::vector<std::future<fast_big_integer>> results;
+				results.reserve(1);
+				const pool_jobs_guard guard = { thread_pool, results };
 
-			return result_bytes;
-		}
+				results.push_back(thread_pool.run([digits, size, low_size, base]()
+				{
+					fast_big_integer high;
+					high.bytes_ = fast_big_integer::create_from_digits(digits, size - low_size, base);
+					return high;
+				}));
 
-		/**
-		 * \brief perform shift bits to right
-		 * \param shift_count bits shift count
-		 */
-		void fast_shr(const size_t shift_count)
-		{
-			if(this->is_zero())
-				return;
+				fast_big_integer low;
+				low.bytes_ = fast_big_integer::create_from_digits(digits + size - low_size, low_size, base);
 
-			constexpr byte eight = 8; // 1 byte contains 8 bits
-			const size_t byte_shift_count = shift_count / eight;
+				fast_big_integer result = thread_pool.wait_and_help(results.front());
+				result.mul(*radix_powers_cache::power(base, level));
 
-			if(byte_shift_count >= this->bytes_.size())
+				return (result + low).bytes_;
+			}
+
+			// chunks[0] is the most significant chunk, it contains size % d digits (or full chunk)
+			std::vector<fast_big_integer> chunks;
+			chunks.reserve(size / chunk_digits_count + 1);
+
+			for (size_t begin = 0, end = (size - 1) % chunk_digits_count + 1; begin < size; begin = end, end += chunk_digits_count)
 			{
-				this->bytes_.clear();
-				return;
+				uint64_t value = 0;
+				size_t j = begin;
+
+				if (base == 10)
+				{
+					for (; j + simd_width <= end; j += simd_width)
+						value = value * 100'000'000 + fast_big_integer::parse_eight_digits(digits + j);
+				}
+
+				for (; j < end; j++)
+					value = value * base + fast_big_integer::digit_value(digits[j]);
+
+				chunks.emplace_back(value);
 			}
-			
-			if(byte_shift_count != 0)
-				this->bytes_.erase(this->bytes_.begin(), this->bytes_.begin() + byte_shift_count);
-			
-			size_t counter = shift_count - byte_shift_count * eight; // get bits shift count
-			
-			for(byte* data = static_cast<byte*>(&this->bytes_.front()), i = static_cast<byte>(this->bytes_.size());
-				counter != 0; // condition
-				counter--, data = static_cast<byte*>(&this->bytes_.front()), i = static_cast<byte>(this->bytes_.size()))
+
+			// each step combines pairs of groups of 2^k chunks, aligned from the least significant chunk
+			for (size_t level = 0; chunks.size() > 1; level++)
 			{
-				*data >>= 1;
-				
-				while(data++, --i != 0)
+				const std::shared_ptr<const fast_big_integer> power = radix_powers_cache::power(base, level); // base^(d * 2^k)
+
+				const size_t pairs_count = chunks.size() / 2;
+				const size_t first = chunks.size() % 2; // the most significant group stays without pair
+
+				for (size_t k = 0; k < pairs_count; k++)
 				{
-					*(data - 1) ^= *data << 7; // branch-less version
-					// eq to:
-					//	if (*data & 0x01) // 0x01 = 1
-					//		*(data - 1) ^= 0x80; // 0x80 = 128
-					*data >>= 1;
+					const size_t high = first + 2 * k;
+
+					chunks[high].mul(*power);
+					chunks[first + k] = chunks[high] + chunks[high + 1];
 				}
+
+				chunks.resize(first + pairs_count);
 			}
 
-			fast_big_integer::clear_zero_bytes(this->bytes_);
+			return chunks.front().bytes_;
 		}
 		/**
-		 * \brief perform shift bits to left
-		 * \param shift_count bits shift count
+		 * \param decimal_string number in dec format
+		 * \return number bytes
 		 */
-		void fast_shl(size_t shift_count)
+		static std::vector<byte> create_from_decimal_string(const std::string& decimal_string)
 		{
-			if (this->is_zero())
-				return;
+			constexpr size_t simd_width = 8;
 
-			constexpr byte eight = 8; // 8 bits in 1 byte
-			const size_t byte_shift_count = shift_count / eight;
-			this->bytes_.insert(this->bytes_.begin(), byte_shift_count, 0); // insert empty bytes_ in begin of vector
+			const size_t size = decimal_string.size();
+			const char* digits = decimal_string.data();
 
-			auto counter = shift_count - byte_shift_count * eight;
-			if (counter == 0) return; // why shift if you can not shift
+			if (size == 0)
+				throw std::invalid_argument("incorrect number");
 
-			this->bytes_.push_back(0); // insert last byte for shifting bits
-			byte* data = nullptr;
-			uint64_t i = 0;
-			while (i = this->bytes_.size() - byte_shift_count - 1, data = &(this->bytes_.back()) - 1, counter-- != 0)
+			size_t i = 0;
+			for (; i + simd_width <= size; i += simd_width)
 			{
-				*(data + 1) <<= 1;
-				*(data + 1) ^= *data >> 7;
-				*data <<= 1;
-
-				while (data--, --i != 0)
-				{
-					*(data + 1) ^= *data >> 7;
-					*data <<= 1;
-				}
+				if (!fast_big_integer::is_eight_digits(digits + i))
+					throw std::invalid_argument("incorrect number");
+			}
+			for (; i < size; i++)
+			{
+				if (digits[i] < '0' || digits[i] > '9')
+					throw std::invalid_argument("incorrect number");
 			}
 
-			fast_big_integer::clear_zero_bytes(this->bytes_);
+			return fast_big_integer::create_from_digits(digits, size, 10);
 		}
 
 		/**
-		 * \brief perform addition to this number
-		 * \param number addition number
+		 * \brief convert 16 hex chars to 16 nibbles at once (sse2), letters of both cases are accepted
+		 * \param chars 16 chars
+		 * \param nibbles will write by values of chars
+		 * \return if all chars are hex digits -> true, else -> false
 		 */
-		void add(const fast_big_integer& number)
+		static bool hex_chars_to_nibbles(const char* chars, __m128i& nibbles)
 		{
-			fast_big_integer::add_classic(*this, number);
+			const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+			const __m128i lower_case_data = _mm_or_si128(data, _mm_set1_epi8(0x20));
+
+			// chars greater then 127 are negative in signed compare, so they are not digits and not letters
+			const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(data, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(data, _mm_set1_epi8('9' + 1)));
+			const __m128i is_letter = _mm_and_si128(_mm_cmpgt_epi8(lower_case_data, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower_case_data, _mm_set1_epi8('f' + 1)));
+
+			nibbles = _mm_or_si128(
+				_mm_and_si128(is_digit, _mm_sub_epi8(data, _mm_set1_epi8('0'))),
+				_mm_and_si128(is_letter, _mm_sub_epi8(lower_case_data, _mm_set1_epi8('a' - 10))));
+
+			return _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) == 0xFFFF;
 		}
 		/**
-		 * \param number addition number
-		 * \return sum of this and parameter numbers
+		 * \brief convert 16 nibbles to 16 hex chars at once (sse2)
+		 * \param nibbles values from 0 to 15
+		 * \param letters_offset distance between '9' + 1 and the first letter
+		 * \param chars will write by 16 chars
 		 */
-		[[nodiscard]] fast_big_integer sum(const fast_big_integer& number) const
+		static void nibbles_to_hex_chars(const __m128i nibbles, const __m128i letters_offset, char* chars)
 		{
-			fast_big_integer sum_result = *this;
-			fast_big_integer::add_classic(sum_result, number);
+			const __m128i is_letter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+			const __m128i data = _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), _mm_and_si128(is_letter, letters_offset));
 
-			return sum_result;
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(chars), data);
 		}
-
 		/**
-		 * \brief perform subtraction from this number
-		 * \param number subtrahend number
+		 * \brief chars are decoded by 32 at once (sse2) in order of string, then bytes are reversed
+		 * \param chars hex digits, the most significant first (odd count is allowed)
+		 * \param size chars count
+		 * \return number bytes
+		 */
+		static std::vector<byte> create_from_hex_string(const char* chars, const size_t size)
+		{
+			constexpr size_t simd_width = 32;
+
+			if (size == 0)
+				throw std::invalid_argument("incorrect number");
+
+			std::vector<byte> bytes(size / 2 + size % 2);
+			byte* destination = bytes.data();
+
+			size_t i = 0;
+			if (size % 2 == 1)
+			{
+				const uint32_t value = fast_big_integer::digit_value(chars[i++]);
+				if (value > 15)
+					throw std::invalid_argument("incorrect number");
+
+				*destination++ = static_cast<byte>(value);
+			}
+
+			for (; i + simd_width <= size; i += simd_width, destination += simd_width / 2)
+			{
+				__m128i first_nibbles, second_nibbles;
+				if (!fast_big_integer::hex_chars_to_nibbles(chars + i, first_nibbles) || !fast_big_integer::hex_chars_to_nibbles(chars + i + simd_width / 2, second_nibbles))
+					throw std::invalid_argument("incorrect number");
+
+				// each 16 bit lane contains the high nibble in the low byte and the low nibble in the high byte
+				const __m128i low_byte_mask = _mm_set1_epi16(0x00FF);
+				const __m128i first_half = _mm_and_si128(_mm_or_si128(_mm_slli_epi16(first_nibbles, 4), _mm_srli_epi16(first_nibbles, 8)), low_byte_mask);
+				const __m128i second_half = _mm_and_si128(_mm_or_si128(_mm_slli_epi16(second_nibbles, 4), _mm_srli_epi16(second_nibbles, 8)), low_byte_mask);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_packus_epi16(first_half, second_half));
+			}
+
+			for (; i < size; i += 2)
+			{
+				const uint32_t high = fast_big_integer::digit_value(chars[i]);
+				const uint32_t low = fast_big_integer::digit_value(chars[i + 1]);
+				if (high > 15 || low > 15)
+					throw std::invalid_argument("incorrect number");
+
+				*destination++ = static_cast<byte>(high << 4 | low);
+			}
+
+			std::reverse(bytes.begin(), bytes.end());
+			fast_big_integer::clear_zero_bytes(bytes);
+
+			return bytes;
+		}
+		/**
+		 * \brief bytes are reversed to order of string, then encoded by 16 at once (sse2)
+		 * \param bytes number bytes
+		 * \param is_upper_case if letters are upper case -> true, else -> false
+		 * \return two hex digits for each byte, the most significant first ("00" for zero)
+		 */
+		static std::string create_hex_string(const std::vector<byte>& bytes, const bool is_upper_case = true)
+		{
+			constexpr size_t simd_width = 16;
+
+			if (bytes.empty())
+				return "00";
+
+			std::vector<byte> reversed_bytes(bytes.rbegin(), bytes.rend());
+			std::string hex_view(bytes.size() * 2, '0');
+
+			const char first_letter = is_upper_case ? 'A' : 'a';
+			const __m128i letters_offset = _mm_set1_epi8(static_cast<char>(first_letter - '9' - 1));
+			const __m128i low_nibble_mask = _mm_set1_epi8(0x0F);
+
+			size_t i = 0;
+			for (; i + simd_width <= reversed_bytes.size(); i += simd_width)
+			{
+				const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&reversed_bytes[i]));
+				const __m128i high_nibbles = _mm_and_si128(_mm_srli_epi16(data, 4), low_nibble_mask);
+				const __m128i low_nibbles = _mm_and_si128(data, low_nibble_mask);
+
+				fast_big_integer::nibbles_to_hex_chars(_mm_unpacklo_epi8(high_nibbles, low_nibbles), letters_offset, &hex_view[2 * i]);
+				fast_big_integer::nibbles_to_hex_chars(_mm_unpackhi_epi8(high_nibbles, low_nibbles), letters_offset, &hex_view[2 * i + simd_width]);
+			}
+
+			for (; i < reversed_bytes.size(); i++)
+			{
+				const byte high = reversed_bytes[i] >> 4;
+				const byte low = reversed_bytes[i] & 0x0F;
+
+				hex_view[2 * i] = static_cast<char>(high < 10 ? '0' + high : first_letter + high - 10);
+				hex_view[2 * i + 1] = static_cast<char>(low < 10 ? '0' + low : first_letter + low - 10);
+			}
+
+			return hex_view;
+		}
+
+		/**
+		 * \brief Newton's iteration with doubling precision, reciprocal of top half of divisor
+		 * is calculated recursively, so cost is about cost of few multiplications of full size
+		 * \param divisor divisor (not equal to zero)
+		 * \return floor(2^(2s) / divisor), s is bit length of divisor
+		 */
+		static fast_big_integer reciprocal(const fast_big_integer& divisor)
+		{
+			const size_t s = divisor.bit_length();
+			const fast_big_integer power = fast_big_integer::extensions::pow2(2 * s);
+
+			if (s <= 64)
+				return power / divisor;
+
+			// top h bits give about h correct bits of reciprocal, Newton's step doubles them
+			const size_t h = s / 2 + 3;
+			fast_big_integer result = fast_big_integer::reciprocal(divisor >> (s - h)) << (s - h);
+
+			// result = result * (2 - divisor * result / 2^(2s))
+			fast_big_integer product = divisor * result;
+			if (product <= power)
+				result = result + (result * (power - product) >> (2 * s));
+			else
+				result = result - (result * (product - power) >> (2 * s));
+
+			// correct error of few units
+			product = divisor * result;
+			while (product > power)
+			{
+				--result;
+				product.sub(divisor);
+			}
+
+			fast_big_integer remainder = power - product;
+			while (remainder >= divisor)
+			{
+				++result;
+				remainder.sub(divisor);
+			}
+
+			return result;
+		}
+		/**
+		 * \brief perform Barrett division, quotient estimation is less then quotient by two at most
+		 * \param dividend dividend (less then 2^(2s))
+		 * \param divisor divisor, s is bit length of divisor
+		 * \param divisor_reciprocal floor(2^(2s) / divisor)
+		 * \param quotient store the result of division
+		 * \param remainder store the remainder
+		 */
+		static void div_by_reciprocal(const fast_big_integer& dividend, const fast_big_integer& divisor, const fast_big_integer& divisor_reciprocal,
+			fast_big_integer& quotient, fast_big_integer& remainder)
+		{
+			const size_t s = divisor.bit_length();
+
+			quotient = ((dividend >> (s - 1)) * divisor_reciprocal) >> (s + 1);
+			remainder = dividend - quotient * divisor;
+
+			while (remainder >= divisor)
+			{
+				++quotient;
+				remainder.sub(divisor);
+			}
+		}
+		/**
+		 * \brief buffer for digits, which is passed to sink by full chunks (when sink is set)
+		 */
+		struct chars_writer
+		{
+			char* first;
+			char* cursor;
+			char* last;
+			const std::function<void(std::string_view)>* sink;
+
+			/**
+			 * \param chars chars for writing
+			 * \param count chars count
+			 * \return if chars fit in buffer or were passed to sink -> true, else -> false
+			 */
+			bool put(const char* chars, size_t count)
+			{
+				while (count > static_cast<size_t>(this->last - this->cursor))
+				{
+					if (this->sink == nullptr)
+						return false;
+
+					const size_t part = static_cast<size_t>(this->last - this->cursor);
+					std::copy(chars, chars + part, this->cursor);
+					chars += part;
+					count -= part;
+
+					(*this->sink)(std::string_view(this->first, static_cast<size_t>(this->last - this->first)));
+					this->cursor = this->first;
+				}
+
+				this->cursor = std::copy(chars, chars + count, this->cursor);
+
+				return true;
+			}
+			/**
+			 * \brief pass written chars to sink
+			 */
+			void flush()
+			{
+				if (this->sink != nullptr && this->cursor != this->first)
+					(*this->sink)(std::string_view(this->first, static_cast<size_t>(this->cursor - this->first)));
+
+				this->cursor = this->first;
+			}
+		};
+		/**
+		 * \brief write digits of number, number is split by halves of digits recursively
+		 * \param number number less then powers[level]
+		 * \param level index of power, which is greater then number
+		 * \param base radix (from 2 to 36)
+		 * \param powers powers base^(d * 2^k)
+		 * \param reciprocals reciprocals of powers
+		 * \param is_padded if leading zeros are written (d * 2^level digits) -> true, else -> false
+		 * \param writer buffer for digits
+		 * \return if digits were written -> true, else -> false
+		 */
+		static bool write_digits(const fast_big_integer& number, const size_t level, const uint32_t base,
+			const std::vector<std::shared_ptr<const fast_big_integer>>& powers, const std::vector<std::shared_ptr<const fast_big_integer>>& reciprocals,
+			const bool is_padded, chars_writer& writer)
+		{
+			if (level == 0)
+			{
+				// number is less then base^d and fits in uint64_t
+				const size_t digits_count = radix_powers_cache::digits_per_word(base);
+
+				uint64_t value = static_cast<uint64_t>(number.try_to_size_t());
+				char digits[64];
+
+				size_t first = digits_count;
+				do
+				{
+					digits[--first] = fast_big_integer::digits_symbols[value % base];
+					value /= base;
+				} while (value != 0);
+
+				std::fill(digits, digits + first, '0');
+
+				if (is_padded)
+					first = 0;
+
+				return writer.put(digits + first, digits_count - first);
+			}
+
+			fast_big_integer high, low;
+			fast_big_integer::div_by_reciprocal(number, *powers[level - 1], *reciprocals[level - 1], high, low);
+
+			if (is_padded || high.is_not_zero())
+			{
+				if (!fast_big_integer::write_digits(high, level - 1, base, powers, reciprocals, is_padded, writer))
+					return false;
+			}
+
+			return fast_big_integer::write_digits(low, level - 1, base, powers, reciprocals, is_padded || high.is_not_zero(), writer);
+		}
+		/**
+		 * \brief write d * 2^level digits with leading zeros, halves of long numbers are written by thread pool
+		 * \param number number less then powers[level]
+		 * \param level index of power, which is greater then number
+		 * \param base radix (from 2 to 36)
+		 * \param powers powers base^(d * 2^k)
+		 * \param reciprocals reciprocals of powers
+		 * \param first begin of slice of d * 2^level chars
+		 */
+		static void write_padded_digits_parallel(const fast_big_integer& number, const size_t level, const uint32_t base,
+			const std::vector<std::shared_ptr<const fast_big_integer>>& powers, const std::vector<std::shared_ptr<const fast_big_integer>>& reciprocals,
+			char* const first)
+		{
+			const size_t digits_count = static_cast<size_t>(radix_powers_cache::digits_per_word(base)) << level;
+
+			const size_t parallel_digits_count = fast_big_integer::parallel_conversion_digits_count.load(std::memory_order_relaxed);
+
+			if (parallel_digits_count == 0 || level == 0 || digits_count < parallel_digits_count)
+			{
+				chars_writer writer = { first, first, first + digits_count, nullptr };
+				fast_big_integer::write_digits(number, level, base, powers, reciprocals, true, writer);
+
+				return;
+			}
+
+			fast_big_integer high, low;
+			fast_big_integer::div_by_reciprocal(number, *powers[level - 1], *reciprocals[level - 1], high, low);
+
+			hpc::thread_pool<fast_big_integer>& thread_pool = hpc::thread_pool<fast_big_integer>::get_instance();
+			std::vector<std::future<fast_big_integer>> results;
+			results.reserve(1);
+			const pool_jobs_guard guard = { thread_pool, results };
+
+			results.push_back(thread_pool.run([&high, level, base, &powers, &reciprocals, first]()
+			{
+				fast_big_integer::write_padded_digits_parallel(high, level - 1, base, powers, reciprocals, first);
+				return fast_big_integer();
+			}));
+
+			fast_big_integer::write_padded_digits_parallel(low, level - 1, base, powers, reciprocals, first + digits_count / 2);
+
+			thread_pool.wait_and_help(results.front());
+		}
+		/**
+		 * \brief the leading digits are split from padded groups of lower digits, which have known
+		 * positions in buffer, so groups are written to disjoint slices by thread pool
+		 * \param number number less then powers[level]
+		 * \param level index of power, which is greater then number
+		 * \param base radix (from 2 to 36)
+		 * \param powers powers base^(d * 2^k)
+		 * \param reciprocals reciprocals of powers
+		 * \param writer buffer for digits (without sink)
+		 * \return if digits fit in buffer -> true, else -> false
+		 */
+		static bool write_digits_parallel(const fast_big_integer& number, const size_t level, const uint32_t base,
+			const std::vector<std::shared_ptr<const fast_big_integer>>& powers, const std::vector<std::shared_ptr<const fast_big_integer>>& reciprocals,
+			chars_writer& writer)
+		{
+			// groups[i] is written by d * 2^levels[i] digits, groups are ordered from the lowest digits
+			std::vector<fast_big_integer> groups;
+			std::vector<size_t> levels;
+
+			fast_big_integer leading = number;
+			for (size_t k = level; k != 0; k--)
+			{
+				if (leading < *powers[k - 1])
+					continue;
+
+				fast_big_integer high, low;
+				fast_big_integer::div_by_reciprocal(leading, *powers[k - 1], *reciprocals[k - 1], high, low);
+
+				groups.push_back(std::move(low));
+				levels.push_back(k - 1);
+				leading = std::move(high);
+			}
+
+			if (!fast_big_integer::write_digits(leading, 0, base, powers, reciprocals, false, writer))
+				return false;
+
+			size_t digits_count = 0;
+			for (const size_t group_level : levels)
+				digits_count += static_cast<size_t>(radix_powers_cache::digits_per_word(base)) << group_level;
+
+			if (static_cast<size_t>(writer.last - writer.cursor) < digits_count)
+				return false;
+
+			hpc::thread_pool<fast_big_integer>& thread_pool = hpc::thread_pool<fast_big_integer>::get_instance();
+			std::vector<std::future<fast_big_integer>> results;
+			results.reserve(groups.size());
+			const pool_jobs_guard guard = { thread_pool, results };
+
+			for (size_t i = groups.size(); i != 0; i--)
+			{
+				const fast_big_integer& group = groups[i - 1];
+				const size_t group_level = levels[i - 1];
+				char* const first = writer.cursor;
+
+				results.push_back(thread_pool.run([&group, group_level, base, &powers, &reciprocals, first]()
+				{
+					fast_big_integer::write_padded_digits_parallel(group, group_level, base, powers, reciprocals, first);
+					return fast_big_integer();
+				}));
+
+				writer.cursor += static_cast<size_t>(radix_powers_cache::digits_per_word(base)) << group_level;
+			}
+
+			for (std::future<fast_big_integer>& result : results)
+				thread_pool.wait_and_help(result);
+
+			return true;
+		}
+		/**
+		 * \brief digits of power of two base are taken from bits directly, other digits are split by cached powers of base
+		 * (splits allocate temporary numbers, working space is not reused between calls)
+		 * \param writer buffer for digits
+		 * \param base radix (from 2 to 36)
+		 * \return if digits were written -> true, else -> false
+		 */
+		bool write_number(chars_writer& writer, const uint32_t base) const
+		{
+			if (this->is_zero())
+				return writer.put("0", 1);
+
+			if (std::has_single_bit(base))
+			{
+				const size_t digit_bits_count = static_cast<size_t>(std::countr_zero(base));
+				const size_t digits_count = (this->bit_length() + digit_bits_count - 1) / digit_bits_count;
+
+				if (writer.sink == nullptr && static_cast<size_t>(writer.last - writer.cursor) < digits_count)
+					return false;
+
+				char digits[64];
+				for (size_t i = digits_count; i != 0; )
+				{
+					size_t count = 0;
+					for (; count < sizeof(digits) && i != 0; count++, i--)
+						digits[count] = fast_big_integer::digits_symbols[fast_big_integer::bits_window(*this, (i - 1) * digit_bits_count, digit_bits_count)];
+
+					writer.put(digits, count);
+				}
+
+				return true;
+			}
+
+			// powers[k] = base^(d * 2^k), the last power is greater then this
+			std::vector<std::shared_ptr<const fast_big_integer>> powers = { radix_powers_cache::power(base, 0) };
+			while (*powers.back() <= *this)
+				powers.push_back(radix_powers_cache::power(base, powers.size()));
+
+			std::vector<std::shared_ptr<const fast_big_integer>> reciprocals;
+			for (size_t k = 0; k + 1 < powers.size(); k++)
+				reciprocals.push_back(radix_powers_cache::reciprocal(base, k));
+
+			// digits are written in parallel to disjoint slices of buffer, so sink is filled by one thread
+			const size_t max_digits_count = static_cast<size_t>(radix_powers_cache::digits_per_word(base)) << (powers.size() - 1);
+			const size_t parallel_digits_count = fast_big_integer::parallel_conversion_digits_count.load(std::memory_order_relaxed);
+			if (writer.sink == nullptr && parallel_digits_count != 0 && max_digits_count >= 2 * parallel_digits_count)
+				return fast_big_integer::write_digits_parallel(*this, powers.size() - 1, base, powers, reciprocals, writer);
+
+			return fast_big_integer::write_digits(*this, powers.size() - 1, base, powers, reciprocals, false, writer);
+		}
+
+		inline static const char digits_symbols[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+		/**
+		 * \brief file header: magic "FBIN", version (4 bytes), bytes count (8 bytes), checksum (8 bytes),
+		 * reserved zeros (8 bytes), so number bytes start from offset aligned for simd loads
+		 */
+		static constexpr size_t file_header_size = 32;
+		static constexpr uint32_t file_version = 1;
+		inline static const char file_magic[4] = { 'F', 'B', 'I', 'N' };
+
+		/**
+		 * \brief FNV-1a by 64 bit words in four independent lanes, so it runs near memory speed
+		 * \param data bytes
+		 * \param size bytes count
+		 * \return checksum of bytes
+		 */
+		static uint64_t file_checksum(const byte* data, const size_t size)
+		{
+			constexpr uint64_t fnv_prime = 0x100000001B3;
+			constexpr size_t lanes_count = 4;
+
+			uint64_t lanes[lanes_count] = { 0xCBF29CE484222325, 0x84222325CBF29CE4, 0xCE484222325CBF29, 0x2325CBF29CE48422 };
+
+			size_t i = 0;
+			for (; i + lanes_count * sizeof(uint64_t) <= size; i += lanes_count * sizeof(uint64_t))
+			{
+				for (size_t lane = 0; lane < lanes_count; lane++)
+				{
+					uint64_t word;
+					std::memcpy(&word, data + i + lane * sizeof(uint64_t), sizeof(word));
+					lanes[lane] = (lanes[lane] ^ word) * fnv_prime;
+				}
+			}
+
+			uint64_t result = size;
+			for (const uint64_t lane : lanes)
+				result = (result ^ lane) * fnv_prime;
+
+			for (; i < size; i++)
+				result = (result ^ data[i]) * fnv_prime;
+
+			return result;
+		}
+		/**
+		 * \param header first file_header_size bytes of file
+		 * \param file_size bytes count of file
+		 * \param bytes_count will write by number bytes count
+		 * \param checksum will write by checksum of number bytes
+		 */
+		static void read_file_header(const byte* header, const size_t file_size, uint64_t& bytes_count, uint64_t& checksum)
+		{
+			uint32_t version;
+			std::memcpy(&version, header + 4, sizeof(version));
+			std::memcpy(&bytes_count, header + 8, sizeof(bytes_count));
+			std::memcpy(&checksum, header + 16, sizeof(checksum));
+
+			if (std::memcmp(header, fast_big_integer::file_magic, sizeof(fast_big_integer::file_magic)) != 0 || version != fast_big_integer::file_version)
+				throw std::invalid_argument("incorrect file");
+
+			if (bytes_count != file_size - fast_big_integer::file_header_size)
+				throw std::invalid_argument("incorrect file");
+		}
+
+	public:
+
+		class montgomery_context;
+		class fixed_base_pow;
+		struct binary_splitting_sums;
+
+		/**
+		 * \brief process-wide cache of powers base^(d * 2^k) and their reciprocals, d is count of base digits
+		 * in uint64_t, powers are calculated lazily by squaring and are shared by conversions of all threads,
+		 * lock is held only for lookup and store, so threads calculate missing levels concurrently
+		 */
+		class radix_powers_cache
+		{
+		public:
+			static constexpr size_t default_memory_limit = static_cast<size_t>(64) << 20; // 64 MiB
+
+		private:
+			struct level
+			{
+				std::shared_ptr<const fast_big_integer> power;
+				std::shared_ptr<const fast_big_integer> reciprocal;
+			};
+
+			struct storage
+			{
+				std::mutex locker;
+				std::vector<std::vector<level>> levels = std::vector<std::vector<level>>(37); // levels of each base
+				size_t memory_usage = 0; // bytes count of cached numbers
+				size_t memory_limit = default_memory_limit;
+			};
+
+			static storage& get_storage()
+			{
+				static storage instance;
+
+				return instance;
+			}
+
+			/**
+			 * \param base radix
+			 * \param k index of power
+			 * \param number member of level (power or reciprocal)
+			 * \return cached number or empty pointer
+			 */
+			static std::shared_ptr<const fast_big_integer> find(const uint32_t base, const size_t k, std::shared_ptr<const fast_big_integer> level::* number)
+			{
+				storage& cache = radix_powers_cache::get_storage();
+				std::lock_guard<std::mutex> lock(cache.locker);
+
+				const std::vector<level>& levels = cache.levels[base];
+
+				return k < levels.size() ? levels[k].*number : nullptr;
+			}
+			/**
+			 * \brief store number calculated without lock, if other thread has not stored it yet and memory limit allows it
+			 * \param base radix
+			 * \param k index of power
+			 * \param number member of level (power or reciprocal)
+			 * \param result calculated number
+			 * \return cached number (calculated by this or other thread)
+			 */
+			static std::shared_ptr<const fast_big_integer> publish(const uint32_t base, const size_t k, std::shared_ptr<const fast_big_integer> level::* number,
+				const std::shared_ptr<const fast_big_integer>& result)
+			{
+				storage& cache = radix_powers_cache::get_storage();
+				std::lock_guard<std::mutex> lock(cache.locker);
+
+				std::vector<level>& levels = cache.levels[base];
+				if (levels.size() <= k)
+					levels.resize(k + 1);
+
+				std::shared_ptr<const fast_big_integer>& slot = levels[k].*number;
+				if (slot)
+					return slot;
+
+				const size_t bytes_count = result->bytes_.size();
+				if (cache.memory_usage + bytes_count <= cache.memory_limit)
+				{
+					slot = result;
+					cache.memory_usage += bytes_count;
+				}
+
+				return result;
+			}
+			/**
+			 * \brief lock is held only for lookup and store, squaring is performed without lock
+			 * \param base radix
+			 * \param k index of power
+			 * \return base^(d * 2^k)
+			 */
+			static std::shared_ptr<const fast_big_integer> get_power(const uint32_t base, const size_t k)
+			{
+				if (std::shared_ptr<const fast_big_integer> cached = radix_powers_cache::find(base, k, &level::power))
+					return cached;
+
+				std::shared_ptr<const fast_big_integer> result;
+				if (k == 0)
+				{
+					uint64_t value = 1;
+					for (uint32_t i = 0; i < radix_powers_cache::digits_per_word(base); i++)
+						value *= base;
+
+					result = std::make_shared<const fast_big_integer>(value);
+				}
+				else
+					result = std::make_shared<const fast_big_integer>(radix_powers_cache::get_power(base, k - 1)->square());
+
+				return radix_powers_cache::publish(base, k, &level::power, result);
+			}
+
+		public:
+			/**
+			 * \param base radix (from 2 to 36)
+			 * \return the greatest count of base digits d such that base^d fits in uint64_t
+			 */
+			static uint32_t digits_per_word(const uint32_t base)
+			{
+				uint32_t count = 0;
+				for (uint64_t value = base; value <= std::numeric_limits<uint64_t>::max() / base; value *= base)
+					count++;
+
+				return count + 1;
+			}
+			/**
+			 * \param base radix (from 2 to 36)
+			 * \param k index of power
+			 * \return base^(d * 2^k), d is digits_per_word(base)
+			 */
+			static std::shared_ptr<const fast_big_integer> power(const uint32_t base, const size_t k)
+			{
+				if (base < 2 || base > 36)
+					throw std::invalid_argument("base must be from 2 to 36");
+
+				return radix_powers_cache::get_power(base, k);
+			}
+			/**
+			 * \param base radix (from 2 to 36)
+			 * \param k index of power
+			 * \return reciprocal of power(base, k) for Barrett division
+			 */
+			static std::shared_ptr<const fast_big_integer> reciprocal(const uint32_t base, const size_t k)
+			{
+				if (base < 2 || base > 36)
+					throw std::invalid_argument("base must be from 2 to 36");
+
+				if (std::shared_ptr<const fast_big_integer> cached = radix_powers_cache::find(base, k, &level::reciprocal))
+					return cached;
+
+				const std::shared_ptr<const fast_big_integer> power = radix_powers_cache::get_power(base, k);
+				const auto result = std::make_shared<const fast_big_integer>(fast_big_integer::reciprocal(*power));
+
+				return radix_powers_cache::publish(base, k, &level::reciprocal, result);
+			}
+			/**
+			 * \brief remove all cached powers, numbers which are used by conversions stay valid
+			 */
+			static void clear()
+			{
+				storage& cache = radix_powers_cache::get_storage();
+				std::lock_guard<std::mutex> lock(cache.locker);
+
+				cache.levels = std::vector<std::vector<level>>(37);
+				cache.memory_usage = 0;
+			}
+			/**
+			 * \param bytes_count max bytes count of cached numbers (powers over limit are calculated without caching)
+			 */
+			static void set_memory_limit(const size_t bytes_count)
+			{
+				storage& cache = radix_powers_cache::get_storage();
+				std::lock_guard<std::mutex> lock(cache.locker);
+
+				cache.memory_limit = bytes_count;
+			}
+			/**
+			 * \return bytes count of cached numbers
+			 */
+			static size_t memory_usage()
+			{
+				storage& cache = radix_powers_cache::get_storage();
+				std::lock_guard<std::mutex> lock(cache.locker);
+
+				return cache.memory_usage;
+			}
+		};
+
+		/**
+		 * \param digits_count min digits count of conversions, which are split between threads of pool (0 -> conversions are serial)
+		 */
+		static void set_parallel_conversion_threshold(const size_t digits_count)
+		{
+			fast_big_integer::parallel_conversion_digits_count.store(digits_count, std::memory_order_relaxed);
+		}
+		/**
+		 * \return min digits count of conversions, which are split between threads of pool (0 -> conversions are serial)
+		 */
+		static size_t parallel_conversion_threshold()
+		{
+			return fast_big_integer::parallel_conversion_digits_count.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * \brief contains all extensions methods to working
+		 */
+		struct extensions
+		{
+			/**
+			 * \param a first number
+			 * \param b second number
+			 * \return largest of the numbers
+			 */
+			static fast_big_integer max(const fast_big_integer& a, const fast_big_integer& b)
+			{
+				return a > b ? a : b;
+			}
+			/**
+			 * \param a first number
+			 * \param b second number
+			 * \return smallest of numbers
+			 */
+			static fast_big_integer min(const fast_big_integer& a, const fast_big_integer& b)
+			{
+				return a < b ? a : b;
+			}
+
+			/**
+			 * \param a fist number
+			 * \param b second number
+			 * \return greatest common divisor number
+			 */
+			static fast_big_integer gcd(const fast_big_integer& a, const fast_big_integer& b)
+			{
+				fast_big_integer tmp_a = a, tmp_b = b;
+
+				while (tmp_b.is_not_zero())
+				{
+					fast_big_integer rem, q;
+					fast_big_integer::div_classic(tmp_a, tmp_b, q, rem);
+
+					tmp_a = tmp_b;
+					tmp_b = rem;
+				}
+
+				return tmp_a;
+			}
+			/**
+			 * \param a fist number
+			 * \param b second number
+			 * \return least common multiple number
+			 */
+			static fast_big_integer lcm(const fast_big_integer& a, const fast_big_integer& b)
+			{
+				return (a * b / fast_big_integer::extensions::gcd(a, b));
+			}
+			/**
+			 * \brief extended euclidean algorithm, cofactors are stored as non-negative numbers
+			 * \param a fist number (can be zero only when b is zero)
+			 * \param b second number
+			 * \param s will write by cofactor of a, 0 < s <= b / gcd (or one when b is zero)
+			 * \param t will write by cofactor of b, 0 <= t < a / gcd
+			 * \return greatest common divisor number, a * s - b * t = gcd
+			 */
+			static fast_big_integer xgcd(const fast_big_integer& a, const fast_big_integer& b, fast_big_integer& s, fast_big_integer& t)
+			{
+				if (a.is_zero() && b.is_zero())
+				{
+					s.set_zero();
+					t.set_zero();
+					return fast_big_integer::zero();
+				}
+
+				const fast_big_integer g = fast_big_integer::extensions::xgcd_cofactor(a, b, s);
+
+				if (b.is_zero())
+					t.set_zero();
+				else
+					t = (a * s - g) / b; // exact division
+
+				return g;
+			}
+			/**
+			 * \param a number for inversion
+			 * \param m modulus
+			 * \return x such that a * x = 1 (mod m), 0 <= x < m
+			 */
+			static fast_big_integer mod_inverse(const fast_big_integer& a, const fast_big_integer& m)
+			{
+				if (m.is_zero())
+					throw std::invalid_argument("modulus is zero");
+				if (m.is_one())
+					return fast_big_integer::zero();
+
+				const fast_big_integer reduced = a < m ? a : a % m;
+				if (reduced.is_zero())
+					throw std::invalid_argument("number is not invertible");
+
+				fast_big_integer s;
+				if (!fast_big_integer::extensions::xgcd_cofactor(reduced, m, s).is_one())
+					throw std::invalid_argument("number is not invertible");
+
+				return s;
+			}
+
+			/**
+			 * \param numbers leaves of tree
+			 * \return levels of product tree, first level is numbers and last is their product
+			 */
+			static std::vector<std::vector<fast_big_integer>> product_tree(const std::span<const fast_big_integer> numbers)
+			{
+				std::vector<std::vector<fast_big_integer>> tree;
+				if (numbers.empty())
+					return tree;
+
+				tree.emplace_back(numbers.begin(), numbers.end());
+
+				while (tree.back().size() > 1)
+				{
+					const std::vector<fast_big_integer>& level = tree.back();
+
+					std::vector<fast_big_integer> next_level = fast_big_integer::extensions::run_on_thread_pool((level.size() + 1) / 2,
+						[&level](const size_t i)
+						{
+							return 2 * i + 1 < level.size() ? level[2 * i] * level[2 * i + 1] : level[2 * i];
+						});
+
+					tree.push_back(std::move(next_level));
+				}
+
+				return tree;
+			}
+			/**
+			 * \param x any number
+			 * \param tree levels of product tree (see product_tree)
+			 * \return x mod leaf for each leaf of tree
+			 */
+			static std::vector<fast_big_integer> remainder_tree(const fast_big_integer& x, const std::vector<std::vector<fast_big_integer>>& tree)
+			{
+				if (tree.empty())
+					return {};
+
+				std::vector<fast_big_integer> remainders = { x % tree.back().front() };
+
+				for (size_t level_index = tree.size() - 1; level_index != 0; level_index--)
+				{
+					const std::vector<fast_big_integer>& level = tree[level_index - 1];
+
+					remainders = fast_big_integer::extensions::run_on_thread_pool(level.size(),
+						[&level, &remainders](const size_t i)
+						{
+							return remainders[i / 2] % level[i];
+						});
+				}
+
+				return remainders;
+			}
+			/**
+			 * \brief multiply numbers, two smallest numbers are multiplied first
+			 * \param numbers multipliers
+			 * \return product of all numbers
+			 */
+			static fast_big_integer product(const std::span<const fast_big_integer> numbers)
+			{
+				if (numbers.empty())
+					return fast_big_integer::one();
+
+				const auto is_greater = [](const fast_big_integer& a, const fast_big_integer& b)
+				{
+					return a.bytes_.size() > b.bytes_.size();
+				};
+
+				std::vector<fast_big_integer> heap(numbers.begin(), numbers.end());
+				std::make_heap(heap.begin(), heap.end(), is_greater);
+
+				while (heap.size() > 1)
+				{
+					std::pop_heap(heap.begin(), heap.end(), is_greater);
+					fast_big_integer smallest = std::move(heap.back());
+					heap.pop_back();
+
+					std::pop_heap(heap.begin(), heap.end(), is_greater);
+					heap.back().mul(smallest);
+					std::push_heap(heap.begin(), heap.end(), is_greater);
+				}
+
+				return heap.front();
+			}
+
+			/**
+			 * \brief multiply numbers on thread pool: blocks of numbers are multiplied by
+			 * product (smallest first), then block products are paired by size
+			 * \param numbers multipliers
+			 * \return product of all numbers
+			 */
+			static fast_big_integer parallel_product(const std::span<const fast_big_integer> numbers)
+			{
+				if (numbers.empty())
+					return fast_big_integer::one();
+
+				const size_t blocks_count = fast_big_integer::extensions::parallel_blocks_count(numbers.size());
+				const size_t block_size = (numbers.size() + blocks_count - 1) / blocks_count;
+
+				std::vector<fast_big_integer> products = fast_big_integer::extensions::run_on_thread_pool(blocks_count,
+					[&numbers, block_size](const size_t i)
+					{
+						const size_t begin = std::min(i * block_size, numbers.size());
+						const size_t end = std::min(begin + block_size, numbers.size());
+
+						return fast_big_integer::extensions::product(numbers.subspan(begin, end - begin));
+					});
+
+				while (products.size() > 1)
+				{
+					std::sort(products.begin(), products.end(), [](const fast_big_integer& a, const fast_big_integer& b)
+					{
+						return a.bytes_.size() < b.bytes_.size();
+					});
+
+					products = fast_big_integer::extensions::run_on_thread_pool((products.size() + 1) / 2,
+						[&products](const size_t i)
+						{
+							return 2 * i + 1 < products.size() ? products[2 * i] * products[2 * i + 1] : products[2 * i];
+						});
+				}
+
+				return products.front();
+			}
+			/**
+			 * \brief sum numbers on thread pool, each block of numbers is summed by
+			 * carry-save columns, carries are propagated once per block
+			 * \param numbers summands
+			 * \return sum of all numbers
+			 */
+			static fast_big_integer parallel_sum(const std::span<const fast_big_integer> numbers)
+			{
+				const size_t blocks_count = fast_big_integer::extensions::parallel_blocks_count(numbers.size());
+				if (blocks_count == 0)
+					return fast_big_integer::zero();
+
+				const size_t block_size = (numbers.size() + blocks_count - 1) / blocks_count;
+
+				const std::vector<fast_big_integer> sums = fast_big_integer::extensions::run_on_thread_pool(blocks_count,
+					[&numbers, block_size](const size_t i)
+					{
+						const size_t begin = std::min(i * block_size, numbers.size());
+						const size_t end = std::min(begin + block_size, numbers.size());
+
+						return fast_big_integer::extensions::sum_carry_save(numbers.subspan(begin, end - begin));
+					});
+
+				fast_big_integer result;
+				for (const fast_big_integer& sum : sums)
+					result.add(sum);
+
+				return result;
+			}
+
+			/**
+			 * \brief Bernstein's batch gcd: product tree of moduli, remainder tree of
+			 * product by squares of moduli and one gcd per modulus
+			 * \param moduli numbers for test (not equal to zero)
+			 * \return for each modulus gcd with product of all others moduli
+			 */
+			static std::vector<fast_big_integer> batch_gcd(const std::span<const fast_big_integer> moduli)
+			{
+				for (const fast_big_integer& modulus : moduli)
+				{
+					if (modulus.is_zero())
+						throw std::invalid_argument("modulus is zero");
+				}
+
+				std::vector<std::vector<fast_big_integer>> tree = fast_big_integer::extensions::product_tree(moduli);
+				if (tree.empty())
+					return {};
+
+				// remainder tree of product by tree of squares, product mod root^2 is product, so root is not squared,
+				// squares of other levels are calculated lazily in descent
+				std::vector<fast_big_integer> remainders = { tree.back().front() };
+				tree.pop_back();
+
+				while (!tree.empty())
+				{
+					const std::vector<fast_big_integer>& level = tree.back();
+
+					remainders = fast_big_integer::extensions::run_on_thread_pool(level.size(),
+						[&level, &remainders](const size_t i)
+						{
+							return remainders[i / 2] % level[i].square();
+						});
+
+					tree.pop_back();
+				}
+
+				return fast_big_integer::extensions::run_on_thread_pool(moduli.size(),
+					[&moduli, &remainders](const size_t i)
+					{
+						return fast_big_integer::extensions::gcd(remainders[i] / moduli[i], moduli[i]);
+					});
+			}
+
+			/**
+			 * \param base base
+			 * \param exponent exponent
+			 * \param modulus modulus (not equal to zero)
+			 * \return base in power of exponent by modulus
+			 */
+			static fast_big_integer pow_mod(const fast_big_integer& base, const fast_big_integer& exponent, const fast_big_integer& modulus);
+			/**
+			 * \brief squarings are shared by all bases: Straus interleaved windows for few bases,
+			 * Pippenger buckets for many bases
+			 * \param bases bases
+			 * \param exponents exponents (same count as bases)
+			 * \param modulus modulus (not equal to zero)
+			 * \return product of bases[i] in power of exponents[i] by modulus
+			 */
+			static fast_big_integer multi_pow_mod(std::span<const fast_big_integer> bases, std::span<const fast_big_integer> exponents, const fast_big_integer& modulus);
+			/**
+			 * \brief perform trial division by small primes, Miller-Rabin test with base 2
+			 * and strong Lucas test (is Baillie-PSW test) and additional Miller-Rabin rounds
+			 * \param n number for test
+			 * \param rounds count of Miller-Rabin rounds with fixed bases 2, 3, 5, 7, ...
+			 * \return if n is probable prime -> true, else -> false
+			 */
+			static bool is_probable_prime(const fast_big_integer& n, const uint32_t rounds = 1);
+
+			/**
+			 * \param max_byte_count max random byte count
+			 * \return random whole number
+			 */
+			static fast_big_integer random(uint32_t max_byte_count = 1000u)
+			{
+				if (max_byte_count == 0)
+					return fast_big_integer::zero();
+
+				std::mt19937_64& rnd = fast_big_integer::extensions::random_engine();
+				std::uniform_int_distribution<uint32_t> rand_size(0, max_byte_count);
+
+				const uint32_t size = rand_size(rnd);
+				if (size == 0) return fast_big_integer::zero();
+
+				std::vector<byte> random_bytes(size);
+				std::uniform_int_distribution<uint32_t> rand_byte(0, 255);
+
+				for (size_t i = 0; i < size; i++)
+					random_bytes[i] = static_cast<byte>(rand_byte(rnd));
+
+				fast_big_integer::clear_zero_bytes(random_bytes);
+
+				return random_bytes;
+			}
+			/**
+			 * \param byte_count random byte count
+			 * \return random whole number with exactly byte_count bytes
+			 */
+			static fast_big_integer random_sizeof(uint32_t byte_count)
+			{
+				const uint32_t size = byte_count;
+				if (size == 0) return fast_big_integer::zero();
+
+				std::mt19937_64& rnd = fast_big_integer::extensions::random_engine();
+				std::vector<byte> random_bytes(size);
+
+				// eight bytes per one generated value
+				for (size_t i = 0; i < size; i += sizeof(uint64_t))
+				{
+					uint64_t value = rnd();
+
+					for (size_t j = i; j < size && j < i + sizeof(uint64_t); j++, value >>= 8)
+						random_bytes[j] = static_cast<byte>(value);
+				}
+
+				while (random_bytes.back() == 0)
+					random_bytes.back() = static_cast<byte>(rnd());
+
+				return random_bytes;
+			}
+
+			/**
+			 * \param n any number
+			 * \param rounds count of Miller-Rabin rounds (see is_probable_prime)
+			 * \return smallest probable prime greater then n
+			 */
+			static fast_big_integer next_prime(const fast_big_integer& n, const uint32_t rounds = 1)
+			{
+				return fast_big_integer::extensions::scan_primes(n.plus_one(), rounds, false);
+			}
+			/**
+			 * \brief same as next_prime, but candidates are tested on thread pool
+			 * \param n any number
+			 * \param rounds count of Miller-Rabin rounds (see is_probable_prime)
+			 * \return smallest probable prime greater then n
+			 */
+			static fast_big_integer next_prime_parallel(const fast_big_integer& n, const uint32_t rounds = 1)
+			{
+				return fast_big_integer::extensions::scan_primes(n.plus_one(), rounds, true);
+			}
+			/**
+			 * \param bits bits count of prime (greater then one)
+			 * \param rounds count of Miller-Rabin rounds (see is_probable_prime)
+			 * \return random probable prime in [2 ^ (bits - 1), 2 ^ bits)
+			 */
+			static fast_big_integer random_prime(const size_t bits, const uint32_t rounds = 1)
+			{
+				return fast_big_integer::extensions::random_prime_of_size(bits, rounds, false);
+			}
+			/**
+			 * \brief same as random_prime, but candidates are tested on thread pool
+			 * \param bits bits count of prime (greater then one)
+			 * \param rounds count of Miller-Rabin rounds (see is_probable_prime)
+			 * \return random probable prime in [2 ^ (bits - 1), 2 ^ bits)
+			 */
+			static fast_big_integer random_prime_parallel(const size_t bits, const uint32_t rounds = 1)
+			{
+				return fast_big_integer::extensions::random_prime_of_size(bits, rounds, true);
+			}
+
+			/**
+			 * \param hex_string hex digits of both cases, the most significant first (odd count is allowed)
+			 * \return whole number (zero for empty string)
+			 */
+			static fast_big_integer create_from_hex(const std::string& hex_string)
+			{
+				if (hex_string.empty())
+					return fast_big_integer::zero();
+
+				fast_big_integer result;
+				result.bytes_ = fast_big_integer::create_from_hex_string(hex_string.data(), hex_string.size());
+
+				return result;
+			}
+
+			static fast_big_integer pow(const fast_big_integer& n, const fast_big_integer& power)
+			{
+				return n.pow(power);
+			}
+			static fast_big_integer factorial(const fast_big_integer& n)
+			{
+				return n.factorial();
+			}
+			/**
+			 * \brief perform Luschny's prime swing algorithm, n! = ((n / 2)!) ^ 2 * swing(n)
+			 * \param n any number
+			 * \return factorial of n
+			 */
+			static fast_big_integer factorial(const uint64_t n)
+			{
+				if (n < 2)
+					return fast_big_integer::one();
+				if (n > std::numeric_limits<uint32_t>::max())
+					throw std::invalid_argument("number is too large for factorial");
+
+				const std::vector<uint32_t> primes = primes::sieve(static_cast<uint32_t>(n));
+
+				return fast_big_integer::extensions::factorial_prime_swing(n, primes);
+			}
+			static fast_big_integer factorial_parallel(const fast_big_integer& n)
+			{
+				return n.factorial_parallel();
+			}
+			/**
+			 * \brief exponent of each prime is counted by Legendre's formula (is count of carries
+			 * in k + (n - k) by Kummer's theorem), so no factorials and no division are performed
+			 * \param n any number
+			 * \param k any number
+			 * \return binomial coefficient C(n, k)
+			 */
+			static fast_big_integer binomial(const uint64_t n, uint64_t k)
+			{
+				if (k > n)
+					return fast_big_integer::zero();
+				if (n > std::numeric_limits<uint32_t>::max())
+					throw std::invalid_argument("number is too large for binomial");
+
+				k = std::min(k, n - k);
+				if (k == 0)
+					return fast_big_integer::one();
+
+				const std::vector<uint32_t> primes = primes::sieve(static_cast<uint32_t>(n));
+
+				return fast_big_integer::extensions::prime_powers_product(primes, n, [n, k](const uint64_t p)
+				{
+					// all primes in (n - k, n] divide C(n, k) exactly once
+					if (p > n - k)
+						return static_cast<uint64_t>(1);
+
+					return fast_big_integer::extensions::legendre_exponent(n, p) -
+						fast_big_integer::extensions::legendre_exponent(k, p) -
+						fast_big_integer::extensions::legendre_exponent(n - k, p);
+				});
+			}
+			/**
+			 * \param counts counts of each kind of elements
+			 * \return multinomial coefficient (k1 + k2 + ...)! / (k1! * k2! * ...)
+			 */
+			static fast_big_integer multinomial(const std::span<const uint64_t> counts)
+			{
+				uint64_t n = 0;
+				for (const uint64_t count : counts)
+				{
+					if (count > std::numeric_limits<uint32_t>::max() - n)
+						throw std::invalid_argument("number is too large for multinomial");
+
+					n += count;
+				}
+
+				if (n < 2)
+					return fast_big_integer::one();
+
+				const std::vector<uint32_t> primes = primes::sieve(static_cast<uint32_t>(n));
+
+				return fast_big_integer::extensions::prime_powers_product(primes, n, [n, &counts](const uint64_t p)
+				{
+					uint64_t exponent = fast_big_integer::extensions::legendre_exponent(n, p);
+					for (const uint64_t count : counts)
+						exponent -= fast_big_integer::extensions::legendre_exponent(count, p);
+
+					return exponent;
+				});
+			}
+			/**
+			 * \brief fast doubling: F(2k) = F(k) * (2 * F(k + 1) - F(k)), F(2k + 1) = F(k)^2 + F(k + 1)^2,
+			 * each step takes three squarings (F(k)^2, F(k + 1)^2 and (F(k) + F(k + 1))^2) and no multiplications
+			 * \param n index
+			 * \return pair of Fibonacci numbers F(n) and F(n + 1)
+			 */
+			static std::pair<fast_big_integer, fast_big_integer> fibonacci_pair(const uint64_t n)
+			{
+				fast_big_integer f_k = fast_big_integer::zero();
+				fast_big_integer f_k_next = fast_big_integer::one();
+
+				for (int32_t bit = 63 - std::countl_zero(n | 1); bit >= 0; bit--)
+				{
+					const fast_big_integer a = f_k.square();
+					const fast_big_integer b = f_k_next.square();
+					const fast_big_integer c = (f_k + f_k_next).square();
+
+					// F(2k + 1) = a + b, F(2k + 2) = c - a, F(2k) = F(2k + 2) - F(2k + 1)
+					fast_big_integer f_odd = a + b;
+					fast_big_integer f_even_next = c - a;
+
+					if (n >> bit & 1)
+					{
+						f_k = std::move(f_odd);
+						f_k_next = std::move(f_even_next);
+					}
+					else
+					{
+						f_k = f_even_next - f_odd;
+						f_k_next = std::move(f_odd);
+					}
+				}
+
+				return { std::move(f_k), std::move(f_k_next) };
+			}
+			/**
+			 * \param n index
+			 * \return Fibonacci number F(n)
+			 */
+			static fast_big_integer fibonacci(const uint64_t n)
+			{
+				return fast_big_integer::extensions::fibonacci_pair(n).first;
+			}
+			/**
+			 * \param n index
+			 * \return Lucas number L(n) = 2 * F(n + 1) - F(n)
+			 */
+			static fast_big_integer lucas(const uint64_t n)
+			{
+				const auto [f_n, f_n_next] = fast_big_integer::extensions::fibonacci_pair(n);
+
+				return (f_n_next << 1) - f_n;
+			}
+			/**
+			 * \brief binary splitting of series S = sum of (+-) a(k) * (p(begin) * ... * p(k)) / (q(begin) * ... * q(k))
+			 * over k in [begin, end), halves of long ranges are calculated in parallel on thread pool
+			 * \param begin first term index
+			 * \param end index after last term (greater then begin)
+			 * \param p function of term index, numerator of ratio of neighbour terms
+			 * \param q function of term index, denominator of ratio of neighbour terms (not equal to zero)
+			 * \param a function of term index, multiplier of term
+			 * \param is_alternating if sign of term k is (-1)^k -> true, else (all terms are positive) -> false
+			 * \return P = p(begin) * ... * p(end - 1), Q = q(begin) * ... * q(end - 1) and T such that S = T / Q
+			 */
+			template <typename PTerm, typename QTerm, typename ATerm>
+			static binary_splitting_sums binary_splitting(uint64_t begin, uint64_t end, const PTerm& p, const QTerm& q, const ATerm& a, bool is_alternating = false);
+			/**
+			 * \brief Chudnovsky series summed by binary splitting
+			 * \param digits count of decimal digits after point
+			 * \return pi * 10^digits (truncated)
+			 */
+			static fast_big_integer pi(size_t digits);
+			/**
+			 * \brief series of inverse factorials summed by binary splitting
+			 * \param digits count of decimal digits after point
+			 * \return e * 10^digits (truncated)
+			 */
+			static fast_big_integer e(size_t digits);
+			static fast_big_integer log_n(const fast_big_integer& x, size_t n)
+			{
+				return x.log_n(n);
+			}
+			static fast_big_integer log_2(const fast_big_integer& x)
+			{
+				return x.log_n(2);
+			}
+			static fast_big_integer sqrt(const fast_big_integer& n)
+			{
+				return n.sqrt();
+			}
+			/**
+			 * \param n any number
+			 * \param remainder will write by n - root^2
+			 * \return integer square root of n
+			 */
+			static fast_big_integer sqrtrem(const fast_big_integer& n, fast_big_integer& remainder)
+			{
+				return n.sqrtrem(remainder);
+			}
+			/**
+			 * \brief Newton's iteration y = ((k - 1) * y + x / y^(k - 1)) / k, seeded by floating point
+			 * estimation of root from top bits of x, so only few iterations are needed
+			 * \param x any number
+			 * \param k root degree (not equal to zero)
+			 * \param remainder will write by x - root^k
+			 * \return integer k-th root of x (the greatest root such that root^k <= x)
+			 */
+			static fast_big_integer nth_root(const fast_big_integer& x, const uint64_t k, fast_big_integer& remainder)
+			{
+				if (k == 0)
+					throw std::invalid_argument("root degree is zero");
+
+				if (k == 1 || x.is_zero() || x.is_one())
+				{
+					remainder.set_zero();
+					return x;
+				}
+				if (k == 2)
+					return x.sqrtrem(remainder);
+
+				// x < 2^bit_length <= 2^k, so root is one
+				if (k >= x.bit_length())
+				{
+					remainder = x.minus_one();
+					return fast_big_integer::one();
+				}
+
+				const fast_big_integer degree = k;
+				const fast_big_integer degree_minus_one = k - 1;
+				// if bit length of y is at least this, y^(k - 1) >= 2^((bit_length(y) - 1) * (k - 1)) > x, so quotient is zero
+				const size_t zero_quotient_bit_length = (x.bit_length() + k - 2) / (k - 1) + 1;
+
+				const auto newton_step = [&x, &degree, &degree_minus_one, zero_quotient_bit_length](const fast_big_integer& y)
+				{
+					if (y.bit_length() >= zero_quotient_bit_length)
+						return degree_minus_one * y / degree;
+
+					return (degree_minus_one * y + x / y.pow(degree_minus_one)) / degree;
+				};
+
+				// first step from any positive estimation gets root or number greater then root,
+				// after that iterations decrease monotonically
+				fast_big_integer root = newton_step(fast_big_integer::extensions::root_estimate(x, k));
+
+				while (true)
+				{
+					fast_big_integer next = newton_step(root);
+					if (next >= root)
+						break;
+
+					root = std::move(next);
+				}
+
+				remainder = x - root.pow(degree);
+
+				return root;
+			}
+			/**
+			 * \param x any number
+			 * \param k root degree (not equal to zero)
+			 * \return integer k-th root of x (the greatest root such that root^k <= x)
+			 */
+			static fast_big_integer nth_root(const fast_big_integer& x, const uint64_t k)
+			{
+				fast_big_integer remainder;
+				return fast_big_integer::extensions::nth_root(x, k, remainder);
+			}
+			/**
+			 * \brief candidates for each prime exponent p are filtered by trailing zero bits and by
+			 * p-th power residues modulo small primes before any root is calculated
+			 * \param x any number
+			 * \param base will write by the least base such that base^exponent = x
+			 * \param exponent will write by the greatest exponent such that base^exponent = x
+			 * \return if x = base^exponent for some exponent greater then one -> true, else -> false
+			 */
+			static bool is_perfect_power(const fast_big_integer& x, fast_big_integer& base, uint64_t& exponent)
+			{
+				base = x;
+				exponent = 1;
+
+				if (x.is_zero() || x.is_one())
+					return false;
+
+				// if x = r^p, then p divides count of zero bits at the end of x
+				size_t zero_bits_count = fast_big_integer::trailing_zero_bits(x);
+
+				// if base = r^p, then r >= 2, so p < bit length of base
+				const std::vector<uint32_t> primes = primes::sieve(static_cast<uint32_t>(std::min<size_t>(x.bit_length(), std::numeric_limits<uint32_t>::max())));
+
+				// when base is replaced by root r, r is not q-th power for all checked q, so scan is continued
+				size_t i = 0;
+				while (i < primes.size() && primes[i] < base.bit_length())
+				{
+					const uint32_t p = primes[i];
+
+					if ((zero_bits_count == 0 || zero_bits_count % p == 0) && fast_big_integer::extensions::is_power_residue(base, p))
+					{
+						fast_big_integer remainder;
+						fast_big_integer root = fast_big_integer::extensions::nth_root(base, p, remainder);
+
+						if (remainder.is_zero())
+						{
+							// root can be p-th power too, so p is checked again
+							base = std::move(root);
+							exponent *= p;
+							zero_bits_count /= p;
+							continue;
+						}
+					}
+
+					i++;
+				}
+
+				return exponent > 1;
+			}
+			static fast_big_integer is_power_of_two(const fast_big_integer& n)
+			{
+				return n.is_power_of_two();
+			}
+			static fast_big_integer pow2(size_t power)
+			{
+				if (power == 0)
+					return { 1 };
+				if (power == 1)
+					return { 2 };
+				
+				constexpr byte eight = 8; // eight bits in byte
+				const size_t byte_count = power / eight;
+				const size_t bits_shift_count = power - byte_count * eight;
+
+				std::vector<byte> bytes(byte_count + 1);
+				bytes.back() = 1 << bits_shift_count;
+
+				return bytes;
+			}
+
+		private:
+			extensions() = default;
+
+			/**
+			 * \param left sums of range [begin, middle)
+			 * \param right sums of range [middle, end)
+			 * \return sums of range [begin, end): P = P1 * P2, Q = Q1 * Q2, T = T1 * Q2 + P1 * T2
+			 */
+			static binary_splitting_sums merge_binary_splitting(const binary_splitting_sums& left, const binary_splitting_sums& right);
+
+			/**
+			 * \param x any number (greater then one)
+			 * \param k root degree (greater then one)
+			 * \return estimation of k-th root of x by top 64 bits of x
+			 */
+			static fast_big_integer root_estimate(const fast_big_integer& x, const uint64_t k)
+			{
+				const size_t bit_length = x.bit_length();
+				const size_t shift = bit_length > 64 ? bit_length - 64 : 0;
+
+				const double log = std::log2(static_cast<double>((x >> shift).try_to_size_t())) + static_cast<double>(shift);
+				const double root_log = log / static_cast<double>(k);
+
+				if (root_log < 62)
+					return static_cast<uint64_t>(std::exp2(root_log)) + 1;
+
+				// keep 52 bits of mantissa, other bits are zeros
+				const size_t root_shift = static_cast<size_t>(root_log) - 52;
+
+				return fast_big_integer(static_cast<uint64_t>(std::exp2(root_log - static_cast<double>(root_shift))) + 1) << root_shift;
+			}
+			/**
+			 * \brief checks Euler's criterion r^((q - 1) / p) = 1 (mod q) for primes q = 1 (mod p),
+			 * when x is not p-th power, each check fails with probability about 1 - 1 / p
+			 * \param x any number
+			 * \param p prime exponent
+			 * \return if x is not p-th power -> false, else (x can be p-th power) -> true
+			 */
+			static bool is_power_residue(const fast_big_integer& x, const uint32_t p)
+			{
+				constexpr size_t max_checks_count = 8;
+				// primality of q is checked by trial division with small primes
+				constexpr uint64_t q_limit = static_cast<uint64_t>(primes::small_primes_limit) * primes::small_primes_limit;
+
+				const auto is_prime = [](const uint64_t q)
+				{
+					for (const uint32_t d : primes::small_primes)
+					{
+						if (static_cast<uint64_t>(d) * d > q)
+							break;
+						if (q % d == 0)
+							return false;
+					}
+
+					return true;
+				};
+
+				size_t checks_count = 0;
+
+				for (uint64_t q = 2 * static_cast<uint64_t>(p) + 1; q < q_limit && checks_count < max_checks_count; q += 2 * static_cast<uint64_t>(p))
+				{
+					if (!is_prime(q))
+						continue;
+
+					checks_count++;
+
+					const uint64_t r = fast_big_integer::rem_word(x, static_cast<uint32_t>(q));
+					if (r == 0)
+						continue;
+
+					// r^((q - 1) / p) mod q
+					uint64_t result = 1, power = r;
+					for (uint64_t e = (q - 1) / p; e != 0; e >>= 1)
+					{
+						if (e & 1)
+							result = result * power % q;
+						power = power * power % q;
+					}
+
+					if (result != 1)
+						return false;
+				}
+
+				return true;
+			}
+
+			/**
+			 * \brief perform calculations on thread pool (or on current thread, when it is only one),
+			 * current thread performs queued jobs while waiting, so it can be called from jobs of pool
+			 * \param count calculations count
+			 * \param calculation function of calculation index
+			 * \return results of calculations
+			 */
+			template <typename Calculation>
+			static std::vector<fast_big_integer> run_on_thread_pool(const size_t count, const Calculation& calculation)
+			{
+				std::vector<fast_big_integer> results(count);
+
+				if (count < 2 || std::thread::hardware_concurrency() < 2)
+				{
+					for (size_t i = 0; i < count; i++)
+						results[i] = calculation(i);
+
+					return results;
+				}
+
+				hpc::thread_pool<fast_big_integer>& thread_pool = hpc::thread_pool<fast_big_integer>::get_instance();
+
+				// jobs reference calculation, so they are joined on every exit path
+				std::vector<std::future<fast_big_integer>> future_results(count);
+				const pool_jobs_guard guard = { thread_pool, future_results };
+
+				for (size_t i = 0; i < count; i++)
+				{
+					future_results[i] = thread_pool.run([&calculation, i]()
+					{
+						return calculation(i);
+					});
+				}
+
+				for (size_t i = 0; i < count; i++)
+					results[i] = thread_pool.wait_and_help(future_results[i]);
+
+				return results;
+			}
+
+			/**
+			 * \param count count of values
+			 * \return count of blocks for splitting values between threads of thread pool
+			 */
+			static size_t parallel_blocks_count(const size_t count)
+			{
+				constexpr size_t blocks_per_thread = 4;
+
+				const size_t threads_count = std::max(std::thread::hardware_concurrency(), 1u);
+
+				return std::min(count, threads_count * blocks_per_thread);
+			}
+			/**
+			 * \brief sum numbers by 32 bits columns without carry propagation
+			 * \param numbers summands (less then 2 ^ 32 numbers)
+			 * \return sum of all numbers
+			 */
+			static fast_big_integer sum_carry_save(const std::span<const fast_big_integer> numbers)
+			{
+				constexpr size_t word_size = sizeof(uint32_t);
+
+				// each column can store 2 ^ 32 words without overflow
+				std::vector<uint64_t> columns;
+
+				for (const fast_big_integer& number : numbers)
+				{
+					const std::vector<byte>& bytes = number.bytes_;
+					const size_t words_count = (bytes.size() + word_size - 1) / word_size;
+
+					if (columns.size() < words_count)
+						columns.resize(words_count);
+
+					const size_t full_words_count = bytes.size() / word_size;
+					for (size_t i = 0; i < full_words_count; i++)
+					{
+						const byte* data = &bytes[i * word_size];
+						columns[i] += static_cast<uint64_t>(data[0]) | static_cast<uint64_t>(data[1]) << 8 |
+							static_cast<uint64_t>(data[2]) << 16 | static_cast<uint64_t>(data[3]) << 24;
+					}
+
+					for (size_t i = full_words_count * word_size; i < bytes.size(); i++)
+						columns[full_words_count] += static_cast<uint64_t>(bytes[i]) << (i % word_size * 8);
+				}
+
+				std::vector<byte> result;
+				result.reserve((columns.size() + 2) * word_size);
+
+				uint64_t carry = 0;
+				for (size_t i = 0; i < columns.size() || carry != 0; i++)
+				{
+					uint64_t value = carry;
+					carry = 0;
+
+					if (i < columns.size())
+					{
+						value += columns[i] & 0xFFFFFFFF;
+						carry = columns[i] >> 32;
+					}
+
+					carry += value >> 32;
+
+					for (size_t j = 0; j < word_size; j++)
+						result.push_back(static_cast<byte>(value >> (j * 8)));
+				}
+
+				fast_big_integer::clear_zero_bytes(result);
+
+				return result;
+			}
+
+			/**
+			 * \param n any number
+			 * \param primes all primes which are less or equal to n (and maybe greater)
+			 * \return factorial of n
+			 */
+			static fast_big_integer factorial_prime_swing(const uint64_t n, const std::vector<uint32_t>& primes)
+			{
+				if (n < 2)
+					return fast_big_integer::one();
+
+				fast_big_integer result = fast_big_integer::extensions::factorial_prime_swing(n / 2, primes);
+				result = result.square();
+				result.mul(fast_big_integer::extensions::prime_swing(n, primes));
+
+				return result;
+			}
+			/**
+			 * \param n any number
+			 * \param primes all primes which are less or equal to n (and maybe greater)
+			 * \return swing(n) = n! / ((n / 2)!) ^ 2
+			 */
+			static fast_big_integer prime_swing(const uint64_t n, const std::vector<uint32_t>& primes)
+			{
+				// exponent of p is count of odd values of n / p ^ k
+				return fast_big_integer::extensions::prime_powers_product(primes, n, [n](const uint64_t p)
+				{
+					uint64_t exponent = 0;
+					for (uint64_t q = n / p; q != 0; q /= p)
+						exponent += q & 1;
+
+					return exponent;
+				});
+			}
+			/**
+			 * \param n any number
+			 * \param p prime
+			 * \return exponent of p in n! (Legendre's formula)
+			 */
+			static uint64_t legendre_exponent(const uint64_t n, const uint64_t p)
+			{
+				uint64_t exponent = 0;
+				for (uint64_t q = n / p; q != 0; q /= p)
+					exponent += q;
+
+				return exponent;
+			}
+			/**
+			 * \brief prime powers are packed into words, words are multiplied by balanced product
+			 * \param primes all primes which are less or equal to limit (and maybe greater)
+			 * \param limit max prime for product
+			 * \param exponent function of prime, which returns exponent of prime
+			 * \return product of p ^ exponent(p) for all primes p less or equal to limit
+			 */
+			template <typename Exponent>
+			static fast_big_integer prime_powers_product(const std::vector<uint32_t>& primes, const uint64_t limit, const Exponent& exponent)
+			{
+				std::vector<fast_big_integer> words;
+				uint64_t word = 1;
+
+				const auto end = std::upper_bound(primes.begin(), primes.end(), limit);
+				for (auto prime = primes.begin(); prime != end; ++prime)
+				{
+					const uint64_t p = *prime;
+
+					for (uint64_t i = exponent(p); i != 0; i--)
+					{
+						if (word > std::numeric_limits<uint64_t>::max() / p)
+						{
+							words.emplace_back(word);
+							word = 1;
+						}
+
+						word *= p;
+					}
+				}
+
+				words.emplace_back(word);
+
+				return fast_big_integer::extensions::product(words);
+			}
+
+			/**
+			 * \brief engine is seeded once per thread by 8 words of random_device, so one seed
+			 * does not limit count of possible streams to 2^32
+			 * \return pseudo random generator of current thread
+			 */
+			static std::mt19937_64& random_engine()
+			{
+				thread_local std::mt19937_64 engine = []()
+				{
+					std::random_device device;
+					std::seed_seq seeds = { device(), device(), device(), device(), device(), device(), device(), device() };
+
+					return std::mt19937_64(seeds);
+				}();
+
+				return engine;
+			}
+
+			/**
+			 * \brief sieve candidates in windows of odd offsets by small primes residues,
+			 * only survivors are tested by is_probable_prime
+			 * \param start first candidate
+			 * \param rounds count of Miller-Rabin rounds
+			 * \param is_parallel if true -> survivors are tested on thread pool
+			 * \return smallest probable prime greater or equal to start
+			 */
+			static fast_big_integer scan_primes(const fast_big_integer& start, const uint32_t rounds, const bool is_parallel)
+			{
+				constexpr auto& table = primes::small_primes;
+				constexpr size_t window_size = 4096; // odd offsets in one window
+
+				if (start <= static_cast<uint64_t>(table.back()))
+					return static_cast<uint64_t>(*std::lower_bound(table.begin(), table.end(), static_cast<uint32_t>(start.try_to_size_t())));
+
+				fast_big_integer candidate = start.is_odd() ? start : start.plus_one();
+
+				// residues are computed once, next windows only shift them
+				std::vector<uint32_t> residues(table.size());
+				for (size_t i = 1; i < table.size();)
+				{
+					uint64_t group_product = table[i];
+					size_t group_end = i + 1;
+
+					while (group_end < table.size() && group_product * table[group_end] <= std::numeric_limits<uint32_t>::max())
+						group_product *= table[group_end++];
+
+					const uint32_t rem = fast_big_integer::rem_word(candidate, static_cast<uint32_t>(group_product));
+
+					for (; i < group_end; i++)
+						residues[i] = rem % table[i];
+				}
+
+				std::vector<bool> is_composite(window_size);
+				std::vector<uint64_t> survivors; survivors.reserve(window_size);
+
+				while (true)
+				{
+					is_composite.assign(window_size, false);
+
+					for (size_t i = 1; i < table.size(); i++)
+					{
+						const uint32_t p = table[i];
+						const uint32_t r = residues[i];
+
+						// first offset with candidate + 2 * offset = 0 (mod p)
+						size_t offset = r == 0 ? 0 : ((p - r) % 2 == 0 ? (p - r) / 2 : (2 * p - r) / 2);
+
+						for (; offset < window_size; offset += p)
+							is_composite[offset] = true;
+
+						residues[i] = static_cast<uint32_t>((r + 2 * window_size) % p);
+					}
+
+					survivors.clear();
+					for (size_t offset = 0; offset < window_size; offset++)
+					{
+						if (!is_composite[offset])
+							survivors.push_back(2 * offset);
+					}
+
+					if (!is_parallel)
+					{
+						for (const uint64_t shift : survivors)
+						{
+							fast_big_integer prime_candidate = candidate + shift;
+
+							if (fast_big_integer::extensions::is_probable_prime(prime_candidate, rounds))
+								return prime_candidate;
+						}
+					}
+					else
+					{
+						// survivors are split to ordered blocks, block stops on its first prime or when earlier block has found prime
+						const size_t blocks_count = fast_big_integer::extensions::parallel_blocks_count(survivors.size());
+						const size_t block_size = blocks_count == 0 ? 0 : (survivors.size() + blocks_count - 1) / blocks_count;
+						std::atomic<size_t> first_found_block = blocks_count;
+
+						const std::vector<fast_big_integer> primes = fast_big_integer::extensions::run_on_thread_pool(blocks_count,
+							[&candidate, &survivors, &first_found_block, block_size, rounds](const size_t i)
+							{
+								const size_t begin = std::min(i * block_size, survivors.size());
+								const size_t end = std::min(begin + block_size, survivors.size());
+
+								for (size_t j = begin; j < end && first_found_block.load(std::memory_order_relaxed) > i; j++)
+								{
+									fast_big_integer prime_candidate = candidate + survivors[j];
+
+									if (fast_big_integer::extensions::is_probable_prime(prime_candidate, rounds))
+									{
+										size_t found_block = first_found_block.load(std::memory_order_relaxed);
+										while (found_block > i && !first_found_block.compare_exchange_weak(found_block, i, std::memory_order_relaxed))
+										{
+										}
+
+										return prime_candidate;
+									}
+								}
+
+								return fast_big_integer::zero();
+							});
+
+						// zero is not prime, so first not zero result is smallest prime
+						for (const fast_big_integer& prime : primes)
+						{
+							if (!prime.is_zero())
+								return prime;
+						}
+					}
+
+					candidate.add(static_cast<uint64_t>(2 * window_size));
+				}
+			}
+			/**
+			 * \param bits bits count of prime (greater then one)
+			 * \param rounds count of Miller-Rabin rounds
+			 * \param is_parallel if true -> candidates are tested on thread pool
+			 * \return random probable prime in [2 ^ (bits - 1), 2 ^ bits)
+			 */
+			static fast_big_integer random_prime_of_size(const size_t bits, const uint32_t rounds, const bool is_parallel)
+			{
+				if (bits < 2)
+					throw std::invalid_argument("bits count must be greater then one");
+
+				const fast_big_integer upper_bound = fast_big_integer::extensions::pow2(bits);
+				const uint32_t byte_count = static_cast<uint32_t>((bits + 7) / 8);
+				const byte top_bit = static_cast<byte>(1 << ((bits - 1) % 8));
+
+				while (true)
+				{
+					fast_big_integer start = fast_big_integer::extensions::random_sizeof(byte_count);
+
+					// exactly bits count bits
+					start.bytes_.back() &= static_cast<byte>((top_bit << 1) - 1);
+					start.bytes_.back() |= top_bit;
+
+					fast_big_integer prime = fast_big_integer::extensions::scan_primes(start, rounds, is_parallel);
+					if (prime < upper_bound)
+						return prime;
+				}
+			}
+
+			/**
+			 * \brief strong probable prime test
+			 * \param context montgomery context of tested number
+			 * \param base base of test
+			 * \return if tested number is strong probable prime to base -> true, else -> false
+			 */
+			static bool miller_rabin(const montgomery_context& context, const fast_big_integer& base);
+			/**
+			 * \brief Straus interleaved exponentiation, table of 2^w powers for each base
+			 * \param context montgomery context of modulus
+			 * \param bases bases
+			 * \param exponents exponents
+			 * \param window_bits_count bits count in window w
+			 * \return product of powers in Montgomery form
+			 */
+			static fast_big_integer multi_pow_straus(const montgomery_context& context, std::span<const fast_big_integer> bases,
+				std::span<const fast_big_integer> exponents, size_t window_bits_count);
+			/**
+			 * \brief Pippenger exponentiation, bases are gathered to buckets by window value for each window
+			 * \param context montgomery context of modulus
+			 * \param bases bases
+			 * \param exponents exponents
+			 * \param window_bits_count bits count in window w
+			 * \return product of powers in Montgomery form
+			 */
+			static fast_big_integer multi_pow_pippenger(const montgomery_context& context, std::span<const fast_big_integer> bases,
+				std::span<const fast_big_integer> exponents, size_t window_bits_count);
+			/**
+			 * \brief strong Lucas probable prime test with Selfridge parameters
+			 * \param context montgomery context of tested number (has no small factors)
+			 * \return if tested number is strong Lucas probable prime -> true, else -> false
+			 */
+			static bool strong_lucas(const montgomery_context& context);
+			/**
+			 * \brief extended euclidean algorithm without cofactor of b
+			 * \param a fist number (not equal to zero)
+			 * \param b second number
+			 * \param s will write by cofactor of a, 0 < s <= b / gcd (or one when b is zero)
+			 * \return greatest common divisor number
+			 */
+			static fast_big_integer xgcd_cofactor(const fast_big_integer& a, const fast_big_integer& b, fast_big_integer& s)
+			{
+				if (a.is_zero())
+					throw std::invalid_argument("a is zero");
+
+				fast_big_integer r0 = a, r1 = b;
+				fast_big_integer s0 = fast_big_integer::one(), s1;
+				bool s0_is_negative = false;
+
+				// cofactors alternate their signs, so only magnitudes are stored
+				while (r1.is_not_zero())
+				{
+					fast_big_integer q, rem;
+					fast_big_integer::div_classic(r0, r1, q, rem);
+
+					fast_big_integer next_s = s0 + q * s1;
+
+					r0 = std::move(r1); r1 = std::move(rem);
+					s0 = std::move(s1); s1 = std::move(next_s);
+					s0_is_negative = !s0_is_negative;
+				}
+
+				if (b.is_zero())
+				{
+					s = fast_big_integer::one();
+					return r0;
+				}
+
+				// move cofactor to (0, b / gcd]
+				const fast_big_integer b_reduced = b / r0;
+				s = s0_is_negative ? b_reduced - s0 : s0;
+				if (s.is_zero())
+					s = b_reduced;
+
+				return r0;
+			}
+		};
+
+		/**
+		 * \brief init number to default value (is zero)
+		 */
+		fast_big_integer() = default;
+		/**
+		 * \brief init number from string
+		 * \param decimal_string number in dec format
+		 */
+		fast_big_integer(const std::string& decimal_string)
+		{
+			this->bytes_ = fast_big_integer::create_from_decimal_string(decimal_string);
+		}
+		fast_big_integer(const char decimal_string[]) : fast_big_integer(std::string(decimal_string)) {}
+		/**
+		 * \brief init number from byte vector
+		 * \param bytes future number bytes
+		 */
+		fast_big_integer(std::vector<byte> bytes)
+		{
+			fast_big_integer::clear_zero_bytes(bytes);
+			this->bytes_ = std::move(bytes);
+		}
+		/**
+		 * \brief init number from byte array
+		 * \param bytes future number bytes
+		 */
+		fast_big_integer(const std::initializer_list<byte> bytes)
+		{
+			std::vector<byte> bts = bytes;
+			fast_big_integer::clear_zero_bytes(bts);
+			this->bytes_ = bts;
+		}
+		/**
+		 * \brief init number from int64_t value
+		 * \param number any number
+		 */
+		fast_big_integer(int64_t number) : bytes_(fast_big_integer::long_to_bytes(number)) {}
+		/**
+		 * \brief init number from uint64_t value
+		 * \param number any number
+		 */
+		fast_big_integer(uint64_t number) : bytes_(fast_big_integer::ulong_to_bytes(number)) {}
+		/**
+		 * \brief init number from int32_t value
+		 * \param number any number
+		 */
+		fast_big_integer(int32_t number) : bytes_(fast_big_integer::int_to_bytes(number)) {}
+		~fast_big_integer()
+		{
+			this->bytes_.clear();
+		}
+
+		/**
+		 * \return number with value "0"
+		 */
+		static fast_big_integer zero()
+		{
+			static fast_big_integer zero;
+			return zero;
+		}
+		/**
+		 * \return number with value "1"
+		 */
+		static fast_big_integer one()
+		{
+			static fast_big_integer one = { 1 };
+			return one;
+		}
+		/**
+		 * \return number with value "2"
+		 */
+		static fast_big_integer two()
+		{
+			static fast_big_integer two = { 2 };
+			return two;
+		}
+		/**
+		 * \return number with value "3"
+		 */
+		static fast_big_integer three()
+		{
+			static fast_big_integer three = { 3 };
+			return three;
+		}
+		
+		/**
+		 * \return dec string view of number
+		 */
+		[[nodiscard]] std::string to_string() const
+		{
+			std::string result(this->max_chars(10), '0');
+
+			const std::to_chars_result conversion = this->to_chars(result.data(), result.data() + result.size(), 10);
+			result.resize(static_cast<size_t>(conversion.ptr - result.data()));
+
+			return result;
+		}
+		/**
+		 * \param base radix (from 2 to 36)
+		 * \return count of chars, which is enough for to_chars in base
+		 */
+		[[nodiscard]] size_t max_chars(const int base = 10) const
+		{
+			if (base < 2 || base > 36)
+				throw std::invalid_argument("base must be from 2 to 36");
+
+			// digits count is floor(log_base(this)) + 1, one more char covers rounding of logarithm
+			return static_cast<size_t>(static_cast<double>(this->bit_length()) / std::log2(static_cast<double>(base))) + 2;
+		}
+		/**
+		 * \brief write digits without leading zeros in lower case by std::to_chars conventions, digits of power
+		 * of two base are taken from bits directly (without allocations), other digits are split by cached powers
+		 * of base, this allocates lists of powers and quotients and remainders of each split (about two sizes of number)
+		 * \param first begin of buffer
+		 * \param last end of buffer
+		 * \param base radix (from 2 to 36)
+		 * \return pointer after the last written char, or last and std::errc::value_too_large when buffer is too small
+		 */
+		std::to_chars_result to_chars(char* first, char* const last, const int base = 10) const
+		{
+			if (base < 2 || base > 36)
+				throw std::invalid_argument("base must be from 2 to 36");
+
+			chars_writer writer = { first, first, last, nullptr };
+
+			if (!this->write_number(writer, static_cast<uint32_t>(base)))
+				return { last, std::errc::value_too_large };
+
+			return { writer.cursor, std::errc() };
+		}
+		/**
+		 * \brief write digits without leading zeros in lower case by chunks, so only one chunk of chars
+		 * is kept in memory (digits are produced by same conversion as to_chars)
+		 * \param sink function, which takes each chunk of chars in order
+		 * \param base radix (from 2 to 36)
+		 * \param chunk_size chars count in chunk (the last chunk may be shorter)
+		 */
+		void write_to(const std::function<void(std::string_view)>& sink, const int base = 10, const size_t chunk_size = 1 << 16) const
+		{
+			if (base < 2 || base > 36)
+				throw std::invalid_argument("base must be from 2 to 36");
+			if (chunk_size == 0)
+				throw std::invalid_argument("chunk size must be greater then zero");
+
+			std::vector<char> buffer(chunk_size);
+			chars_writer writer = { buffer.data(), buffer.data(), buffer.data() + buffer.size(), &sink };
+
+			this->write_number(writer, static_cast<uint32_t>(base));
+			writer.flush();
+		}
+		/**
+		 * \brief read the longest sequence of digits by std::from_chars conventions (letters of both cases)
+		 * \param first begin of chars
+		 * \param last end of chars
+		 * \param value will write by read number (is not changed, when there is no digits)
+		 * \param base radix (from 2 to 36)
+		 * \return pointer after the last digit, or first and std::errc::invalid_argument when there is no digits
+		 */
+		static std::from_chars_result from_chars(const char* first, const char* const last, fast_big_integer& value, const int base = 10)
+		{
+			if (base < 2 || base > 36)
+				throw std::invalid_argument("base must be from 2 to 36");
+
+			const uint32_t radix = static_cast<uint32_t>(base);
+
+			const char* end = first;
+			while (end != last && fast_big_integer::digit_value(*end) < radix)
+				end++;
+
+			if (end == first)
+				return { first, std::errc::invalid_argument };
+
+			value.bytes_ = fast_big_integer::create_from_digits(first, static_cast<size_t>(end - first), radix);
+
+			return { end, std::errc() };
+		}
+		/**
+		 * \param is_upper_case if letters are upper case -> true, else -> false
+		 * \return hex string view of number
+		 */
+		[[nodiscard]] std::string to_string_hex(const bool is_upper_case = true) const
+		{
+			return fast_big_integer::create_hex_string(this->bytes_, is_upper_case);
+		}
+		/**
+		 * \return byte vector
+		 */
+		[[nodiscard]] std::vector<byte> to_bytes() const
+		{
+			return this->bytes_;
+		}
+		/**
+		 * \param word_size bytes count in word (not equal to zero)
+		 * \return bytes count written by export_to with same word size (zero for zero number)
+		 */
+		[[nodiscard]] size_t export_size(const size_t word_size = 1) const
+		{
+			if (word_size == 0)
+				throw std::invalid_argument("word size must be greater then zero");
+
+			return (this->bytes_.size() + word_size - 1) / word_size * word_size;
+		}
+		/**
+		 * \brief write number as words, the least significant word and byte first for little endian,
+		 * the most significant word and byte first for big endian (little endian is a memcpy of number bytes)
+		 * \param destination buffer of export_size(word_size) bytes at least
+		 * \param endian order of words and bytes in words
+		 * \param word_size bytes count in word, the most significant word is padded by zeros
+		 * \return written bytes count
+		 */
+		size_t export_to(const std::span<std::byte> destination, const std::endian endian = std::endian::little, const size_t word_size = 1) const
+		{
+			const size_t size = this->export_size(word_size);
+
+			if (destination.size() < size)
+				throw std::invalid_argument("destination is too small");
+
+			const size_t bytes_count = this->bytes_.size();
+
+			if (endian == std::endian::little)
+			{
+				if (bytes_count != 0)
+					std::memcpy(destination.data(), this->bytes_.data(), bytes_count);
+
+				std::fill(destination.begin() + bytes_count, destination.begin() + size, std::byte{ 0 });
+			}
+			else
+			{
+				std::fill(destination.begin(), destination.begin() + (size - bytes_count), std::byte{ 0 });
+				std::transform(this->bytes_.rbegin(), this->bytes_.rend(), destination.begin() + (size - bytes_count),
+					[](const byte value) { return static_cast<std::byte>(value); });
+			}
+
+			return size;
+		}
+		/**
+		 * \param source words written by export_to (or empty for zero)
+		 * \param endian order of words and bytes in words
+		 * \param word_size bytes count in word, source size must be multiple of it
+		 * \return read number
+		 */
+		static fast_big_integer import_from(const std::span<const std::byte> source, const std::endian endian = std::endian::little, const size_t word_size = 1)
+		{
+			if (word_size == 0 || source.size() % word_size != 0)
+				throw std::invalid_argument("source size must be multiple of word size");
+
+			fast_big_integer result;
+			result.bytes_.resize(source.size());
+
+			if (endian == std::endian::little)
+			{
+				if (!source.empty())
+					std::memcpy(result.bytes_.data(), source.data(), source.size());
+			}
+			else
+			{
+				std::transform(source.rbegin(), source.rend(), result.bytes_.begin(),
+					[](const std::byte value) { return static_cast<byte>(value); });
+			}
+
+			fast_big_integer::clear_zero_bytes(result.bytes_);
+
+			return result;
+		}
+		/**
+		 * \return bytes count written by encode_to: bytes count as LEB128 varint, then number bytes
+		 */
+		[[nodiscard]] size_t encoded_size() const
+		{
+			size_t prefix_size = 1;
+			for (size_t size = this->bytes_.size(); size >= 0x80; size >>= 7)
+				prefix_size++;
+
+			return prefix_size + this->bytes_.size();
+		}
+		/**
+		 * \brief write length prefixed number: bytes count as LEB128 varint, then little endian bytes
+		 * \param destination buffer of encoded_size() bytes at least
+		 * \return written bytes count
+		 */
+		size_t encode_to(const std::span<std::byte> destination) const
+		{
+			const size_t size = this->encoded_size();
+
+			if (destination.size() < size)
+				throw std::invalid_argument("destination is too small");
+
+			size_t position = 0;
+			size_t bytes_count = this->bytes_.size();
+
+			for (; bytes_count >= 0x80; bytes_count >>= 7)
+				destination[position++] = static_cast<std::byte>((bytes_count & 0x7F) | 0x80);
+			destination[position++] = static_cast<std::byte>(bytes_count);
+
+			if (!this->bytes_.empty())
+				std::memcpy(destination.data() + position, this->bytes_.data(), this->bytes_.size());
+
+			return size;
+		}
+		/**
+		 * \param source buffer, which starts from number written by encode_to
+		 * \param read_bytes_count will write by bytes count of read number
+		 * \return read number
+		 */
+		static fast_big_integer decode_from(const std::span<const std::byte> source, size_t& read_bytes_count)
+		{
+			constexpr uint32_t size_bits_count = std::numeric_limits<size_t>::digits;
+
+			size_t bytes_count = 0;
+			size_t position = 0;
+
+			for (uint32_t shift = 0; ; shift += 7)
+			{
+				if (position == source.size() || shift >= size_bits_count)
+					throw std::invalid_argument("incorrect length prefix");
+
+				const uint8_t prefix_byte = static_cast<uint8_t>(source[position++]);
+
+				// bits of the last prefix byte, which do not fit in size_t, must be zero
+				if (shift + 7 > size_bits_count && ((prefix_byte & 0x7F) >> (size_bits_count - shift)) != 0)
+					throw std::invalid_argument("incorrect length prefix");
+
+				bytes_count |= static_cast<size_t>(prefix_byte & 0x7F) << shift;
+
+				if ((prefix_byte & 0x80) == 0)
+					break;
+			}
+
+			if (source.size() - position < bytes_count)
+				throw std::invalid_argument("source is too small");
+
+			fast_big_integer result = fast_big_integer::import_from(source.subspan(position, bytes_count));
+			read_bytes_count = position + bytes_count;
+
+			return result;
+		}
+		/**
+		 * \brief write number bytes after header with checksum (little endian bytes, as in memory)
+		 * \param path file path, file is rewritten
+		 */
+		void save(const std::string& path) const
+		{
+			byte header[fast_big_integer::file_header_size] = {};
+
+			const uint64_t bytes_count = this->bytes_.size();
+			const uint64_t checksum = fast_big_integer::file_checksum(this->bytes_.data(), this->bytes_.size());
+
+			std::memcpy(header, fast_big_integer::file_magic, sizeof(fast_big_integer::file_magic));
+			std::memcpy(header + 4, &fast_big_integer::file_version, sizeof(fast_big_integer::file_version));
+			std::memcpy(header + 8, &bytes_count, sizeof(bytes_count));
+			std::memcpy(header + 16, &checksum, sizeof(checksum));
+
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			if (!file)
+				throw std::invalid_argument("can not open file");
+
+			file.write(reinterpret_cast<const char*>(header), sizeof(header));
+			file.write(reinterpret_cast<const char*>(this->bytes_.data()), static_cast<std::streamsize>(this->bytes_.size()));
+
+			if (!file)
+				throw std::invalid_argument("can not write file");
+		}
+		/**
+		 * \brief read bytes of number directly to its storage and check them by checksum
+		 * \param path file written by save
+		 * \return read number
+		 */
+		static fast_big_integer load(const std::string& path)
+		{
+			std::ifstream file(path, std::ios::binary | std::ios::ate);
+			if (!file)
+				throw std::invalid_argument("can not open file");
+
+			const size_t file_size = static_cast<size_t>(file.tellg());
+			if (file_size < fast_big_integer::file_header_size)
+				throw std::invalid_argument("incorrect file");
+
+			byte header[fast_big_integer::file_header_size];
+			file.seekg(0);
+			file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+			uint64_t bytes_count, checksum;
+			fast_big_integer::read_file_header(header, file_size, bytes_count, checksum);
+
+			fast_big_integer result;
+			result.bytes_.resize(static_cast<size_t>(bytes_count));
+			file.read(reinterpret_cast<char*>(result.bytes_.data()), static_cast<std::streamsize>(bytes_count));
+
+			if (!file || fast_big_integer::file_checksum(result.bytes_.data(), result.bytes_.size()) != checksum)
+				throw std::invalid_argument("incorrect file");
+
+			fast_big_integer::clear_zero_bytes(result.bytes_);
+
+			return result;
+		}
+		/**
+		 * \brief read only number in memory mapped file, it is defined in fast_big_integer_mapped_file.h
+		 */
+		class mapped_number;
+		[[nodiscard]] size_t try_to_size_t() const
+		{
+			if (this->bytes_.size() > sizeof(size_t))
+				throw std::invalid_argument("number greater then max size_t value");
+			if (this->bytes_.empty())
+				return static_cast<size_t>(0);
+			
+			size_t value = 0;
+			for(size_t i = 0; i < this->bytes_.size(); i++)
+			{
+				value <<= 8;
+				value |= this->bytes_[this->bytes_.size() - i - 1];
+			}
+
+			return value;
+		}
+
+		/**
+		 * \brief perform AND operation
+		 * \param number operand
+		 * \return AND operation result between this and number
+		 */
+		fast_big_integer and (const fast_big_integer_view number) const
+		{
+			const size_t result_size = std::min(this->bytes_.size(), number.size());
+			std::vector<byte> result_bytes(result_size);
+
+			for (size_t i = 0; i < result_size; i++)
+				result_bytes[i] = number.data()[i] & this->bytes_[i];
+
+			fast_big_integer::clear_zero_bytes(result_bytes);
+
+			return result_bytes;
+		}
+		/**
+		 * \brief perform OR operation
+		 * \param number operand
+		 * \return OR operation result between this and number
+		 */
+		fast_big_integer or (const fast_big_integer_view number) const
+		{
+			const size_t calculated_part_size = std::min(this->bytes_.size(), number.size());
+			const size_t filled_part_size = std::max(this->bytes_.size(), number.size()) - calculated_part_size;
+			const byte* greater_number_bytes = this->bytes_.size() > number.size() ? this->bytes_.data() : number.data();
+			std::vector<byte> result_bytes(calculated_part_size + filled_part_size);
+
+			for (size_t i = 0; i < calculated_part_size; i++)
+				result_bytes[i] = number.data()[i] | this->bytes_[i];
+
+			for (size_t i = calculated_part_size; i < filled_part_size + calculated_part_size; i++)
+				result_bytes[i] = greater_number_bytes[i];
+
+			fast_big_integer::clear_zero_bytes(result_bytes);
+
+			return result_bytes;
+		}
+		/**
+		 * \brief perform XOR operation
+		 * \param number operand
+		 * \return XOR operation result between this and number
+		 */
+		fast_big_integer xor (const fast_big_integer_view number) const
+		{
+			const size_t calculated_part_size = std::min(this->bytes_.size(), number.size());
+			const size_t filled_part_size = std::max(this->bytes_.size(), number.size()) - calculated_part_size;
+			const byte* greater_number_bytes = this->bytes_.size() > number.size() ? this->bytes_.data() : number.data();
+			std::vector<byte> result_bytes(calculated_part_size + filled_part_size);
+
+			for (size_t i = 0; i < calculated_part_size; i++)
+				result_bytes[i] = number.data()[i] ^ this->bytes_[i];
+
+			for (size_t i = calculated_part_size; i < filled_part_size + calculated_part_size; i++)
+				result_bytes[i] = greater_number_bytes[i];
+
+			fast_big_integer::clear_zero_bytes(result_bytes);
+
+			return result_bytes;
+		}
+
+		/**
+		 * \brief perform shift bits to right
+		 * \param shift_count bits shift count
+		 */
+		void fast_shr(const size_t shift_count)
+		{
+			if(this->is_zero())
+				return;
+
+			constexpr byte eight = 8; // 1 byte contains 8 bits
+			const size_t byte_shift_count = shift_count / eight;
+
+			if(byte_shift_count >= this->bytes_.size())
+			{
+				this->bytes_.clear();
+				return;
+			}
+			
+			if(byte_shift_count != 0)
+				this->bytes_.erase(this->bytes_.begin(), this->bytes_.begin() + byte_shift_count);
+			
+			const size_t bits_shift_count = shift_count - byte_shift_count * eight;
+
+			if (bits_shift_count != 0)
+			{
+				// each byte takes low bits of next byte in one pass
+				const size_t last = this->bytes_.size() - 1;
+				for (size_t i = 0; i < last; i++)
+					this->bytes_[i] = static_cast<byte>(this->bytes_[i] >> bits_shift_count | this->bytes_[i + 1] << (eight - bits_shift_count));
+
+				this->bytes_[last] >>= bits_shift_count;
+			}
+
+			fast_big_integer::clear_zero_bytes(this->bytes_);
+		}
+		/**
+		 * \brief perform shift bits to left
+		 * \param shift_count bits shift count
+		 */
+		void fast_shl(size_t shift_count)
+		{
+			if (this->is_zero())
+				return;
+
+			constexpr byte eight = 8; // 8 bits in 1 byte
+			const size_t byte_shift_count = shift_count / eight;
+			this->bytes_.insert(this->bytes_.begin(), byte_shift_count, 0); // insert empty bytes_ in begin of vector
+
+			const size_t bits_shift_count = shift_count - byte_shift_count * eight;
+			if (bits_shift_count == 0) return; // why shift if you can not shift
+
+			this->bytes_.push_back(0); // insert last byte for shifting bits
+
+			// each byte takes high bits of previous byte in one pass
+			for (size_t i = this->bytes_.size() - 1; i > byte_shift_count; i--)
+				this->bytes_[i] = static_cast<byte>(this->bytes_[i] << bits_shift_count | this->bytes_[i - 1] >> (eight - bits_shift_count));
+
+			this->bytes_[byte_shift_count] = static_cast<byte>(this->bytes_[byte_shift_count] << bits_shift_count);
+
+			fast_big_integer::clear_zero_bytes(this->bytes_);
+		}
+
+		/**
+		 * \brief perform addition to this number
+		 * \param number addition number
+		 */
+		void add(const fast_big_integer& number)
+		{
+			fast_big_integer::add_classic(*this, number);
+		}
+		/**
+		 * \brief perform addition to this number
+		 * \param number addition number (not view of this number)
+		 */
+		void add(const fast_big_integer_view number)
+		{
+			fast_big_integer::add_classic(*this, number);
+		}
+		/**
+		 * \param number addition number
+		 * \return sum of this and parameter numbers
+		 */
+		[[nodiscard]] fast_big_integer sum(const fast_big_integer& number) const
+		{
+			fast_big_integer sum_result = *this;
+			fast_big_integer::add_classic(sum_result, number);
+
+			return sum_result;
+		}
+
+		/**
+		 * \brief perform subtraction from this number
+		 * \param number subtrahend number
 		 */
 		void sub(const fast_big_integer& number)
 		{
-			fast_big_integer::sub_classic(*this, number);
+			fast_big_integer::sub_classic(*this, number);
+		}
+		/**
+		 * \brief perform subtraction from this number
+		 * \param number subtrahend number (not greater then this)
+		 */
+		void sub(const fast_big_integer_view number)
+		{
+			fast_big_integer::sub_classic(*this, number);
+		}
+		/**
+		 * \param number subtrahend number
+		 * \return difference between this and parameter
+		 */
+		[[nodiscard]] fast_big_integer difference(const fast_big_integer& number) const
+		{
+			fast_big_integer sub_result = *this;
+			fast_big_integer::sub_classic(sub_result, number);
+
+			return sub_result;
+		}
+
+		/**
+		 * \brief perform multiply between this and parameter
+		 * \param number multiplier
+		 */
+		void mul(const fast_big_integer& number)
+		{
+			this->mul(static_cast<fast_big_integer_view>(number));
+		}
+		/**
+		 * \brief perform multiply between this and parameter
+		 * \param number multiplier
+		 */
+		void mul(const fast_big_integer_view number)
+		{
+			if (this->is_zero() || number.is_zero())
+			{
+				this->bytes_.clear(); // set zero
+				return;
+			}
+
+			if (number.is_one())
+				return;
+
+			if (this->is_one())
+			{
+				// view of own bytes already equals to product, assign from aliased range is not allowed
+				if (number.data() == this->bytes_.data())
+					return;
+
+				this->bytes_.assign(number.data(), number.data() + number.size());
+				return;
+			}
+
+			this->bytes_ = fast_big_integer::mul_words(*this, number);
+		}
+		/**
+		 * \return product of this and this
+		 */
+		[[nodiscard]] fast_big_integer square() const
+		{
+			if (this->is_zero() || this->is_one())
+				return *this;
+
+			return fast_big_integer::square_words(*this);
+		}
+		/**
+		 * \param multiplier multiplier
+		 * \return product between this and parameter
+		 */
+		[[nodiscard]] fast_big_integer product(const fast_big_integer& multiplier) const
+		{
+			fast_big_integer result = *this;
+			result.mul(multiplier);
+
+			return result;
+		}
+
+		/**
+		 * \param divisor divisor
+		 * \return quotient
+		 */
+		[[nodiscard]] fast_big_integer division(const fast_big_integer& divisor) const
+		{
+			fast_big_integer quotient, remainder;
+			fast_big_integer::div_classic(*this, divisor, quotient, remainder);
+
+			return quotient;
+		}
+		/**
+		 * \param divisor divisor
+		 * \param remainder will write by remainder
+		 * \return quotient
+		 */
+		[[nodiscard]] fast_big_integer division_reminder(const fast_big_integer& divisor, fast_big_integer& remainder) const
+		{
+			fast_big_integer quotient;
+			fast_big_integer::div_classic(*this, divisor, quotient, remainder);
+
+			return quotient;
+		}
+		
+		/**
+		 * \return if this is zero -> true, else -> false
+		 */
+		[[nodiscard]] bool is_zero() const
+		{
+			return this->bytes_.empty();
+		}
+		/**
+		 * \return if this is zero -> false, else -> true
+		 */
+		[[nodiscard]] bool is_not_zero() const
+		{
+			return !this->is_zero();
+		}
+
+		/**
+		 * \return if this is one -> true, else -> false
+		 */
+		[[nodiscard]] bool is_one() const
+		{
+			return this->bytes_.size() == 1 && bytes_.front() == 1;
+		}
+		/**
+		 * \return if this is two -> true, else -> false
+		 */
+		[[nodiscard]] bool is_two() const
+		{
+			return this->bytes_.size() == 1 && bytes_.front() == 2;
+		}
+		/**
+		 * \return if this is power of two -> true, else -> false
+		 */
+		[[nodiscard]] bool is_power_of_two() const
+		{
+			if (this->is_zero())
+				return false;
+
+			for (size_t i = 0; i < bytes_.size() - 1; i++)
+			{
+				if (this->bytes_[i] != 0)
+					return false;
+			}
+
+			return (this->bytes_.back() & this->bytes_.back() - 1) == 0;
+		}
+
+		/**
+		 * \return bits count in number (bytes count × 8)
+		 */
+		[[nodiscard]] size_t num_bits() const
+		{
+			// in one byte eight bits :)
+			return this->bytes_.size() << 3; // * 8
+		}
+		/**
+		 * \return count of significant bits in number (zero for zero)
+		 */
+		[[nodiscard]] size_t bit_length() const
+		{
+			if (this->is_zero())
+				return 0;
+
+			return ((this->bytes_.size() - 1) << 3) + std::bit_width(this->bytes_.back());
+		}
+		/**
+		 * \return hash of number, it is equal to hash of view of number
+		 */
+		[[nodiscard]] size_t hash() const
+		{
+			return static_cast<fast_big_integer_view>(*this).hash();
+		}
+		/**
+		 * \return non-owning view of bytes of number, it is invalidated by changes of number
+		 */
+		operator fast_big_integer_view() const
+		{
+			return { this->bytes_.data(), this->bytes_.size() };
+		}
+		/**
+		 * \return if this is odd -> true, else -> false
+		 */
+		[[nodiscard]] bool is_odd() const
+		{
+			return !this->bytes_.empty() && this->bytes_.front() & 1;
+		}
+		/**
+		 * \return if this is even -> true, else -> false
+		 */
+		[[nodiscard]] bool is_even() const
+		{
+			return !this->is_odd();
+		}
+
+		/**
+		 * \brief set value of this number to zero
+		 */
+		void set_zero()
+		{
+			this->bytes_.clear();
+		}
+
+		void unsafe_set_back_bit_to(bool value)
+		{
+			this->bytes_.front() |= static_cast<byte>(value);
+		}
+
+		/**
+		 * \brief perform prefix increment
+		 * \return this incremented value
+		 */
+		fast_big_integer& operator ++ ()
+		{
+			if (this->is_zero())
+			{
+				this->bytes_.push_back(1);
+				return *this;
+			}
+
+			auto byte_iterator = this->bytes_.begin();
+			const auto end = this->bytes_.end();
+
+			while (++*byte_iterator == 0)
+			{
+				if (++byte_iterator == end)
+					break;
+			}
+
+			if (byte_iterator == end)
+				this->bytes_.push_back(1);
+
+			return *this;
+		}
+		/**
+		 * \brief perform prefix decrement
+		 * \return this decremented value
+		 */
+		fast_big_integer& operator-- ()
+		{
+			if (this->is_zero())
+				throw std::invalid_argument("number can not be less then zero");
+
+			auto bytes_iterator = this->bytes_.begin();
+
+			if (--*bytes_iterator == 0xFF)
+			{
+				while (*++bytes_iterator == 0)
+					*bytes_iterator = 0xFF;
+
+				--*bytes_iterator;
+			}
+
+			if (this->bytes_.back() == 0)
+				this->bytes_.pop_back();
+
+			return *this;
+		}
+
+		/**
+		 * \brief perform postfix increment
+		 * \return this incremented value
+		 */
+		fast_big_integer& operator ++ (int)
+		{
+			return ++*this;
+		}
+		/**
+		 * \brief perform postfix decrement
+		 * \return this decremented value
+		 */
+		fast_big_integer& operator-- (int)
+		{
+			return --*this;
+		}
+
+		fast_big_integer operator + (const fast_big_integer& number) const
+		{
+			return this->sum(number);
+		}
+		fast_big_integer operator - (const fast_big_integer& number) const
+		{
+			return this->difference(number);
+		}
+		fast_big_integer operator * (const fast_big_integer& number) const
+		{
+			return this->product(number);
+		}
+		fast_big_integer operator / (const fast_big_integer& number) const
+		{
+			return this->division(number);
+		}
+		fast_big_integer operator % (const fast_big_integer& number) const
+		{
+			fast_big_integer q, r;
+			fast_big_integer::div_classic(*this, number, q, r);
+
+			return r;
+		}
+		fast_big_integer operator + (const fast_big_integer_view number) const
+		{
+			fast_big_integer sum_result = *this;
+			sum_result.add(number);
+
+			return sum_result;
+		}
+		fast_big_integer operator - (const fast_big_integer_view number) const
+		{
+			fast_big_integer sub_result = *this;
+			sub_result.sub(number);
+
+			return sub_result;
+		}
+		fast_big_integer operator * (const fast_big_integer_view number) const
+		{
+			fast_big_integer result = *this;
+			result.mul(number);
+
+			return result;
+		}
+		// division works with owning divisor, its copy is cheap relative to division
+		fast_big_integer operator / (const fast_big_integer_view number) const
+		{
+			return this->division(number.to_number());
+		}
+		fast_big_integer operator % (const fast_big_integer_view number) const
+		{
+			return *this % number.to_number();
+		}
+
+		fast_big_integer& operator = (const fast_big_integer& number) = default;
+
+		/**
+		 * \param shift_count shift count
+		 * \return shifted to left value
+		 */
+		fast_big_integer operator << (size_t shift_count) const
+		{
+			fast_big_integer copy = *this;
+			copy.fast_shl(shift_count);
+
+			return copy;
 		}
 		/**
-		 * \param number subtrahend number
-		 * \return difference between this and parameter
+		 * \brief perform shift to left
+		 * \param shift_count shift count
 		 */
-		[[nodiscard]] fast_big_integer difference(const fast_big_integer& number) const
+		void operator <<= (size_t shift_count)
 		{
-			fast_big_integer sub_result = *this;
-			fast_big_integer::sub_classic(sub_result, number);
+			this->fast_shl(shift_count);
+		}
+		/**
+		 * \param shift_count shift count
+		 * \return shifted to right value
+		 */
+		fast_big_integer operator >> (size_t shift_count) const
+		{
+			fast_big_integer copy = *this;
+			copy.fast_shr(shift_count);
 
-			return sub_result;
+			return copy;
+		}
+		/**
+		 * \brief perform shift to right
+		 * \param shift_count shift count
+		 */
+		void operator >>= (size_t shift_count)
+		{
+			this->fast_shr(shift_count);
 		}
 
 		/**
-		 * \brief perform multiply between this and parameter
-		 * \param number multiplier
+		 * \brief AND operator
+		 * \param number number
+		 * \return result of "AND" operation
 		 */
-		void mul(const fast_big_integer& number)
+		fast_big_integer operator & (const fast_big_integer& number) const
+		{
+			return this-> and (number);
+		}
+		/**
+		 * \brief OR operator
+		 * \param number number
+		 * \return result of "OR" operation
+		 */
+		fast_big_integer operator | (const fast_big_integer& number) const
+		{
+			return this-> or (number);
+		}
+		/**
+		 * \brief XOR operator
+		 * \param number number
+		 * \return result of "XOR" operation
+		 */
+		fast_big_integer operator ^ (const fast_big_integer& number) const
+		{
+			return this-> xor (number);
+		}
+		fast_big_integer operator & (const fast_big_integer_view number) const
+		{
+			return this-> and (number);
+		}
+		fast_big_integer operator | (const fast_big_integer_view number) const
+		{
+			return this-> or (number);
+		}
+		fast_big_integer operator ^ (const fast_big_integer_view number) const
+		{
+			return this-> xor (number);
+		}
+
+		/**
+		 * \param exponent exponent
+		 * \return this in power of parameter
+		 */
+		[[nodiscard]] fast_big_integer pow(const fast_big_integer& exponent) const
+		{
+			if (exponent.is_zero())
+				return fast_big_integer::one();
+			if (exponent.is_one())
+				return *this;
+
+			fast_big_integer power = exponent;
+			fast_big_integer result = fast_big_integer::one();
+			fast_big_integer x = *this;
+
+			while (power.is_not_zero())
+			{
+				if (power.is_even())
+				{
+					x = x.square();
+					power >>= 1;
+				}
+				else
+				{
+					result = result * x;
+					x = x.square();
+					--power >>= 1;
+				}
+			}
+
+			return result;
+		}
+		/**
+		 * \return factorial of this number
+		 */
+		[[nodiscard]] fast_big_integer factorial() const
+		{
+			if (this->bytes_.size() > sizeof(uint64_t))
+				throw std::invalid_argument("number is too large for factorial");
+
+			return fast_big_integer::extensions::factorial(static_cast<uint64_t>(this->try_to_size_t()));
+		}
+		/**
+		 * \brief perform product of range [2, n] by recursive splitting, right parts are
+		 * calculated by thread pool jobs and left parts by current thread
+		 * \return factorial of this number
+		 */
+		[[nodiscard]] fast_big_integer factorial_parallel() const
 		{
-			struct fft
+			struct factorial_parallel
 			{
-				__declspec(noinline) static uint64_t calculate_expr_value(const std::vector<byte>& a, const std::vector<byte>& b,
-					const size_t left, const size_t right)
+				// approximate bits count of product of range [l, r]
+				static double product_bits_count(const uint64_t l, const uint64_t r)
+				{
+					return (std::lgamma(static_cast<double>(r) + 1.0) - std::lgamma(static_cast<double>(l))) / std::log(2.0);
+				}
+
+				// calculate product of range [l, r] on one thread
+				static fast_big_integer prod_range_one_thread(const uint64_t l, const uint64_t r)
+				{
+					std::vector<fast_big_integer> words;
+					uint64_t word = 1;
+
+					for (uint64_t i = l; i <= r; i++)
+					{
+						if (word > std::numeric_limits<uint64_t>::max() / i)
+						{
+							words.emplace_back(word);
+							word = 1;
+						}
+
+						word *= i;
+					}
+
+					words.emplace_back(word);
+
+					return fast_big_integer::extensions::product(words);
+				}
+
+				static fast_big_integer parallel_prod_tree(const uint64_t l, const uint64_t r)
 				{
-					uint64_t sum = 0;
-					size_t loc_left = left - 1, loc_right = right + 1;
+					// products which are less then this bits count are calculated on one thread
+					constexpr double grain_bits_count = 1 << 16;
 
-					while (++loc_left < --loc_right)
+					const double bits_count = factorial_parallel::product_bits_count(l, r);
+					if (r - l < 2 || bits_count < grain_bits_count)
+						return factorial_parallel::prod_range_one_thread(l, r);
+
+					// split by half of product bits count, not by half of range
+					uint64_t left = l, right = r - 1;
+					while (left < right)
 					{
-						const uint32_t pairs_value = a[loc_left] * b[loc_right] + a[loc_right] * b[loc_left];
-						sum += pairs_value;
+						const uint64_t m = left + (right - left) / 2;
+
+						if (factorial_parallel::product_bits_count(l, m) < bits_count / 2)
+							left = m + 1;
+						else
+							right = m;
 					}
 
-					if (loc_left == loc_right)
-						sum += static_cast<uint64_t>(a[loc_left])* static_cast<uint64_t>(b[loc_right]);
+					const uint64_t m = left;
+
+					hpc::thread_pool<fast_big_integer>& thread_pool = hpc::thread_pool<fast_big_integer>::get_instance();
+
+					std::future<fast_big_integer> right_result = thread_pool.run([m, r]()
+					{
+						return factorial_parallel::parallel_prod_tree(m + 1, r);
+					});
+
+					fast_big_integer result = factorial_parallel::parallel_prod_tree(l, m);
+					result.mul(thread_pool.wait_and_help(right_result));
 
-					return sum;
+					return result;
 				}
 			};
 
-			if (this->is_zero() || number.is_zero())
+			if (this->bytes_.size() > sizeof(uint64_t))
+				throw std::invalid_argument("number is too large for factorial");
+
+			const uint64_t n = static_cast<uint64_t>(this->try_to_size_t());
+
+			if (n < 2)
+				return fast_big_integer::one();
+
+			if (std::thread::hardware_concurrency() < 2)
+				return this->factorial();
+
+			return factorial_parallel::parallel_prod_tree(2, n);
+		}
+		/**
+		 * \brief root of top bits is calculated by hardware sqrt, then each Newton's step doubles
+		 * count of correct bits, so all steps together cost about one division of full size
+		 * \return integer square root of this number (the greatest root such that root^2 <= this)
+		 */
+		[[nodiscard]] fast_big_integer sqrt() const
+		{
+			if (this->is_zero())
+				return fast_big_integer::zero();
+
+			// a is approximation of sqrt(this >> (2c - 2d)) with error less then one, d grows up to c
+			const size_t c = (this->bit_length() - 1) / 2;
+
+			// double has 53 bits of mantissa, so sqrt of numbers less then 2^54 is calculated exactly
+			constexpr size_t hardware_root_bits_count = 26;
+
+			int32_t s = 0;
+			while ((c >> s) > hardware_root_bits_count)
+				s++;
+
+			size_t d = c >> s;
+
+			const uint64_t top = static_cast<uint64_t>((*this >> (2 * c - 2 * d)).try_to_size_t());
+			uint64_t root = static_cast<uint64_t>(std::sqrt(static_cast<double>(top)));
+
+			while (root * root > top)
+				root--;
+			while ((root + 1) * (root + 1) <= top)
+				root++;
+
+			fast_big_integer a = root;
+
+			for (s--; s >= 0; s--)
 			{
-				this->bytes_.clear(); // set zero
-				return;;
+				const size_t e = d;
+				d = c >> s;
+
+				a = (a << (d - e - 1)) + (*this >> (2 * c - e - d + 1)) / a;
+			}
+
+			if (a.square() > *this)
+				--a;
+
+			return a;
+		}
+		/**
+		 * \param remainder will write by this - root^2
+		 * \return integer square root of this number (the greatest root such that root^2 <= this)
+		 */
+		[[nodiscard]] fast_big_integer sqrtrem(fast_big_integer& remainder) const
+		{
+			fast_big_integer root = this->sqrt();
+			remainder = *this - root.square();
+
+			return root;
+		}
+		/**
+		 * \param n base
+		 * \return the base n logarithm of this
+		 */
+		[[nodiscard]] fast_big_integer log_n(size_t n) const
+		{
+			size_t log = 0u;
+			fast_big_integer tmp_this = *this;
+
+			while (!tmp_this.is_one() && tmp_this.is_not_zero())
+			{
+				++log;
+				
+				if(tmp_this >= n)
+					tmp_this = tmp_this / n;
+				else
+					break;
+			}
+
+			return log;
+		}
+		/**
+		 * \return the base two logarithm of this
+		 */
+		[[nodiscard]] fast_big_integer log2() const
+		{
+			uint64_t log = 0u;
+			fast_big_integer tmp_this = *this;
+
+			while (!tmp_this.is_one() && tmp_this.is_not_zero())
+			{
+				++log;
+				tmp_this >>= 1;
 			}
 
-			if (number.is_one())
-				return;
+			return log;
+		}
+
+		[[nodiscard]] fast_big_integer plus_one() const
+		{
+			fast_big_integer copy = *this;
+			return ++copy;
+		}
+		[[nodiscard]] fast_big_integer minus_one() const
+		{
+			fast_big_integer copy = *this;
+			return --copy;
+		}
+
+		std::strong_ordering operator <=> (const fast_big_integer& n) const
+		{
+			return fast_big_integer::compare_optimized(*this, n) <=> 0;
+		}
+		bool operator == (const fast_big_integer& n) const
+		{
+			return fast_big_integer::compare_optimized(*this, n) == 0;
+		}
+		bool operator != (const fast_big_integer& n) const
+		{
+			return fast_big_integer::compare_optimized(*this, n) != 0;
+		}
+
+		[[nodiscard]] bool is_equal(const fast_big_integer& value) const
+		{
+			return fast_big_integer::compare_optimized(*this, value) == 0;
+		}
+		[[nodiscard]] bool is_not_equal(const fast_big_integer& value) const
+		{
+			return fast_big_integer::compare_optimized(*this, value) != 0;
+		}
+		[[nodiscard]] bool is_letter_then(const fast_big_integer& value) const
+		{
+			return fast_big_integer::compare_optimized(*this, value) == -1;
+		}
+		[[nodiscard]] bool is_greater_then(const fast_big_integer& value) const
+		{
+			return fast_big_integer::compare_optimized(*this, value) == 1;
+		}
+	};
+
+	/**
+	 * \brief write digits of number to stream by formatting flags (basefield, uppercase, showbase, width, fill and
+	 * adjustfield), digits are written by chunks without building of whole string, when width is not set
+	 * \param stream output stream
+	 * \param number any number
+	 * \return stream
+	 */
+	inline std::ostream& operator << (std::ostream& stream, const fast_big_integer& number)
+	{
+		const std::ostream::sentry sentry(stream);
+		if (!sentry)
+			return stream;
+
+		const std::ios_base::fmtflags flags = stream.flags();
+		const std::ios_base::fmtflags basefield = flags & std::ios_base::basefield;
+		const int base = basefield == std::ios_base::hex ? 16 : basefield == std::ios_base::oct ? 8 : 10;
+		const bool is_upper_case = (flags & std::ios_base::uppercase) != 0;
+
+		std::string prefix;
+		if ((flags & std::ios_base::showbase) != 0 && number.is_not_zero())
+		{
+			if (base == 16)
+				prefix = is_upper_case ? "0X" : "0x";
+			else if (base == 8)
+				prefix = "0";
+		}
+
+		if (stream.width() <= 0)
+		{
+			stream.write(prefix.data(), static_cast<std::streamsize>(prefix.size()));
 
-			if (this->is_one())
+			std::string upper_case_chunk;
+			number.write_to([&stream, &upper_case_chunk, is_upper_case](const std::string_view chunk)
 			{
-				this->bytes_ = number.bytes_;
-				return;
-			}
+				if (!is_upper_case)
+				{
+					stream.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+					return;
+				}
 
-			std::vector<byte> mul_vector_a(this->bytes_);
-			std::vector<byte> mul_vector_b(number.bytes_);
+				upper_case_chunk.assign(chunk);
+				std::transform(upper_case_chunk.begin(), upper_case_chunk.end(), upper_case_chunk.begin(),
+					[](const char symbol) { return static_cast<char>(std::toupper(static_cast<unsigned char>(symbol))); });
 
-			const size_t total_multipliers_size = std::max(this->bytes_.size(), number.bytes_.size());
+				stream.write(upper_case_chunk.data(), static_cast<std::streamsize>(upper_case_chunk.size()));
+			}, base);
 
-			mul_vector_a.resize(total_multipliers_size);
-			mul_vector_b.resize(total_multipliers_size);
+			return stream;
+		}
 
-			const size_t _left = 0, _right = total_multipliers_size - 1;
-			const uint16_t first_expr_value = mul_vector_a[_left] * mul_vector_b[_left];
-			const uint16_t last_expr_value = mul_vector_a[_right] * mul_vector_b[_right];
+		// padding needs length of digits, so they are written to string
+		std::string digits(number.max_chars(base), '0');
+		digits.resize(static_cast<size_t>(number.to_chars(digits.data(), digits.data() + digits.size(), base).ptr - digits.data()));
 
-			if (total_multipliers_size == 1)
-			{
-				std::vector<byte> result =
-				{
-					static_cast<byte>(first_expr_value),
-					static_cast<byte>(first_expr_value >> 8)
-				};
+		if (is_upper_case)
+		{
+			std::transform(digits.begin(), digits.end(), digits.begin(),
+				[](const char symbol) { return static_cast<char>(std::toupper(static_cast<unsigned char>(symbol))); });
+		}
 
-				if (result[1] == 0)
-					result.pop_back();
+		const size_t width = static_cast<size_t>(stream.width());
+		const size_t padding_size = width > prefix.size() + digits.size() ? width - prefix.size() - digits.size() : 0;
+		const std::string padding(padding_size, stream.fill());
 
-				this->bytes_ = result;
+		const std::ios_base::fmtflags adjustfield = flags & std::ios_base::adjustfield;
 
-				return;
-			}
+		const std::string text = adjustfield == std::ios_base::left ? prefix + digits + padding
+			: adjustfield == std::ios_base::internal ? prefix + padding + digits
+			: padding + prefix + digits;
 
-			uint64_t middle_expr_value = fft::calculate_expr_value(mul_vector_a, mul_vector_b, _left, _right);
+		stream.write(text.data(), static_cast<std::streamsize>(text.size()));
+		stream.width(0);
 
-			std::vector<std::pair<byte, uint64_t>> fft_calculations; fft_calculations.resize(total_multipliers_size * 2 - 1);
-			fft_calculations[0] = std::pair<byte, uint64_t>(static_cast<byte>(first_expr_value), first_expr_value >> 8);
+		return stream;
+	}
 
-			size_t current_fft_calc_index = 1; // because first is inserted
+	inline fast_big_integer fast_big_integer_view::to_number() const
+	{
+		return std::vector<byte>(this->data_, this->data_ + this->size_);
+	}
 
-			for (size_t i = 1; i < _right; i++)
-			{
-				uint64_t value = fft::calculate_expr_value(mul_vector_a, mul_vector_b, _left, i);
-				value += fft_calculations[current_fft_calc_index - 1].second;
+	inline std::string fast_big_integer_view::to_string() const
+	{
+		return this->to_number().to_string();
+	}
 
-				fft_calculations[current_fft_calc_index++] = std::pair<byte, uint64_t>(static_cast<byte>(value), value >> 8);
-			}
+	inline std::to_chars_result fast_big_integer_view::to_chars(char* first, char* last, const int base) const
+	{
+		return this->to_number().to_chars(first, last, base);
+	}
 
-			middle_expr_value += fft_calculations[current_fft_calc_index - 1].second;
-			fft_calculations[current_fft_calc_index++] = std::pair<byte, uint64_t>(static_cast<byte>(middle_expr_value), middle_expr_value >> 8);
+	inline sbyte fast_big_integer_view::compare(const fast_big_integer_view a, const fast_big_integer_view b)
+	{
+		return fast_big_integer::compare_optimized(a, b);
+	}
 
-			for (size_t i = 1; i < _right; i++)
-			{
-				uint64_t value = fft::calculate_expr_value(mul_vector_a, mul_vector_b, i, _right);
-				value += fft_calculations[current_fft_calc_index - 1].second;
+	inline std::strong_ordering operator <=> (const fast_big_integer_view a, const fast_big_integer_view b)
+	{
+		return fast_big_integer_view::compare(a, b) <=> 0;
+	}
 
-				fft_calculations[current_fft_calc_index++] = std::pair<byte, uint64_t>(static_cast<byte>(value), value >> 8);
-			}
+	inline bool operator == (const fast_big_integer_view a, const fast_big_integer_view b)
+	{
+		return fast_big_integer_view::compare(a, b) == 0;
+	}
 
-			fft_calculations[current_fft_calc_index] = std::pair<byte, uint64_t>(
-				static_cast<byte>(last_expr_value + fft_calculations[current_fft_calc_index - 1].second),
-				(last_expr_value + fft_calculations[current_fft_calc_index - 1].second) >> 8
-				);
+	inline fast_big_integer operator & (const fast_big_integer_view a, const fast_big_integer_view b)
+	{
+		return a.to_number() & b;
+	}
 
-			std::vector<byte> result_mul_vector; result_mul_vector.reserve(total_multipliers_size * 2);
-			for (std::pair<byte, uint64_t>& fft_calculation : fft_calculations)
-				result_mul_vector.push_back(fft_calculation.first);
+	inline fast_big_integer operator | (const fast_big_integer_view a, const fast_big_integer_view b)
+	{
+		return a.to_number() | b;
+	}
 
-			const uint64_t last_carry = fft_calculations.back().second;
-			std::vector<byte> carry_bytes = fast_big_integer::ulong_to_bytes(last_carry);
-			if (!carry_bytes.empty())
-			{
-				result_mul_vector.reserve(result_mul_vector.size() + carry_bytes.size());
-				result_mul_vector.insert(result_mul_vector.end(), carry_bytes.begin(), carry_bytes.end());
-			}
+	inline fast_big_integer operator ^ (const fast_big_integer_view a, const fast_big_integer_view b)
+	{
+		return a.to_number() ^ b;
+	}
+
+	/**
+	 * \brief contains precomputed values for Montgomery modular multiplication
+	 */
+	class fast_big_integer::montgomery_context
+	{
+		fast_big_integer modulus_;
+		size_t r_bytes_count_ = 0; // r is 2 ^ (8 * r_bytes_count_)
 
-			fast_big_integer::clear_zero_bytes(result_mul_vector);
+		fast_big_integer modulus_inverse_; // -modulus ^ -1 (mod r)
+		fast_big_integer r_square_; // r ^ 2 (mod modulus)
+		fast_big_integer one_; // r (mod modulus)
 
-			this->bytes_ = result_mul_vector;
-		}
 		/**
-		 * \param multiplier multiplier
-		 * \return product between this and parameter
+		 * \brief set number to number mod r
+		 * \param number number for truncation
 		 */
-		[[nodiscard]] fast_big_integer product(const fast_big_integer& multiplier) const
+		void truncate(fast_big_integer& number) const
 		{
-			fast_big_integer result = *this;
-			result.mul(multiplier);
-
-			return result;
+			if (number.bytes_.size() > this->r_bytes_count_)
+			{
+				number.bytes_.resize(this->r_bytes_count_);
+				fast_big_integer::clear_zero_bytes(number);
+			}
 		}
-
 		/**
-		 * \param divisor divisor
-		 * \return quotient
+		 * \param t number less then modulus * r
+		 * \return t * r ^ -1 (mod modulus)
 		 */
-		[[nodiscard]] fast_big_integer division(const fast_big_integer& divisor) const
+		[[nodiscard]] fast_big_integer reduce(const fast_big_integer& t) const
 		{
-			fast_big_integer quotient, remainder;
-			fast_big_integer::div_classic(*this, divisor, quotient, remainder);
+			fast_big_integer u = t;
+			this->truncate(u);
+			u.mul(this->modulus_inverse_);
+			this->truncate(u);
 
-			return quotient;
+			u.mul(this->modulus_);
+			u.add(t);
+			u.fast_shr(this->r_bytes_count_ * 8);
+
+			if (u >= this->modulus_)
+				u.sub(this->modulus_);
+
+			return u;
 		}
+
+	public:
 		/**
-		 * \param divisor divisor
-		 * \param remainder will write by remainder
-		 * \return quotient
+		 * \param modulus odd modulus, greater then one
 		 */
-		[[nodiscard]] fast_big_integer division_reminder(const fast_big_integer& divisor, fast_big_integer& remainder) const
+		explicit montgomery_context(const fast_big_integer& modulus)
 		{
-			fast_big_integer quotient;
-			fast_big_integer::div_classic(*this, divisor, quotient, remainder);
+			if (modulus.is_even() || modulus.is_one())
+				throw std::invalid_argument("modulus must be odd and greater then one");
 
-			return quotient;
+			this->modulus_ = modulus;
+			this->r_bytes_count_ = modulus.bytes_.size();
+
+			const fast_big_integer r = fast_big_integer::extensions::pow2(this->r_bytes_count_ * 8);
+
+			// Hensel lifting, modulus ^ -1 = modulus (mod 8) and each step doubles correct bits
+			fast_big_integer inverse = modulus;
+			for (size_t correct_bits = 3; correct_bits < this->r_bytes_count_ * 8; correct_bits <<= 1)
+			{
+				fast_big_integer product = modulus * inverse;
+				this->truncate(product);
+
+				inverse.mul(r + fast_big_integer::two() - product);
+				this->truncate(inverse);
+			}
+
+			this->modulus_inverse_ = r - inverse;
+			this->one_ = r % modulus;
+			this->r_square_ = this->one_.square() % modulus;
 		}
-		
+
 		/**
-		 * \return if this is zero -> true, else -> false
+		 * \return modulus of context
 		 */
-		[[nodiscard]] bool is_zero() const
+		[[nodiscard]] const fast_big_integer& modulus() const
 		{
-			return this->bytes_.empty();
+			return this->modulus_;
 		}
 		/**
-		 * \return if this is zero -> false, else -> true
+		 * \return one in Montgomery form
 		 */
-		[[nodiscard]] bool is_not_zero() const
+		[[nodiscard]] const fast_big_integer& montgomery_one() const
 		{
-			return !this->is_zero();
+			return this->one_;
 		}
 
 		/**
-		 * \return if this is one -> true, else -> false
+		 * \param x any number
+		 * \return x in Montgomery form
 		 */
-		[[nodiscard]] bool is_one() const
+		[[nodiscard]] fast_big_integer to_montgomery(const fast_big_integer& x) const
 		{
-			return this->bytes_.size() == 1 && bytes_.front() == 1;
+			return this->reduce((x < this->modulus_ ? x : x % this->modulus_) * this->r_square_);
 		}
 		/**
-		 * \return if this is two -> true, else -> false
+		 * \param x number in Montgomery form
+		 * \return x in normal form
 		 */
-		[[nodiscard]] bool is_two() const
+		[[nodiscard]] fast_big_integer from_montgomery(const fast_big_integer& x) const
 		{
-			return this->bytes_.size() == 1 && bytes_.front() == 2;
+			return this->reduce(x);
 		}
+
 		/**
-		 * \return if this is power of two -> true, else -> false
+		 * \param a number in Montgomery form
+		 * \param b number in Montgomery form
+		 * \return a + b in Montgomery form
 		 */
-		[[nodiscard]] bool is_power_of_two() const
+		[[nodiscard]] fast_big_integer add(const fast_big_integer& a, const fast_big_integer& b) const
 		{
-			if (this->is_zero())
-				return false;
-
-			for (size_t i = 0; i < bytes_.size() - 1; i++)
-			{
-				if (this->bytes_[i] != 0)
-					return false;
-			}
+			fast_big_integer sum = a + b;
+			if (sum >= this->modulus_)
+				sum.sub(this->modulus_);
 
-			return (this->bytes_.back() & this->bytes_.back() - 1) == 0;
+			return sum;
 		}
-
 		/**
-		 * \return bits count in number (bytes count × 8)
+		 * \param a number in Montgomery form
+		 * \param b number in Montgomery form
+		 * \return a - b in Montgomery form
 		 */
-		[[nodiscard]] size_t num_bits() const
+		[[nodiscard]] fast_big_integer sub(const fast_big_integer& a, const fast_big_integer& b) const
 		{
-			// in one byte eight bits :)
-			return this->bytes_.size() << 3; // * 8
+			if (a >= b)
+				return a - b;
+
+			return a + this->modulus_ - b;
 		}
 		/**
-		 * \return if this is odd -> true, else -> false
+		 * \param a number in Montgomery form
+		 * \param b number in Montgomery form
+		 * \return a * b in Montgomery form
 		 */
-		[[nodiscard]] bool is_odd() const
+		[[nodiscard]] fast_big_integer multiply(const fast_big_integer& a, const fast_big_integer& b) const
 		{
-			return !this->bytes_.empty() && this->bytes_.front() & 1;
+			return this->reduce(a * b);
 		}
 		/**
-		 * \return if this is even -> true, else -> false
+		 * \param a number in Montgomery form
+		 * \return a * a in Montgomery form
 		 */
-		[[nodiscard]] bool is_even() const
+		[[nodiscard]] fast_big_integer square(const fast_big_integer& a) const
 		{
-			return !this->is_odd();
+			return this->reduce(a.square());
 		}
 
 		/**
-		 * \brief set value of this number to zero
+		 * \brief perform exponentiation with fixed window of four bits
+		 * \param base base
+		 * \param exponent exponent
+		 * \return base in power of exponent by modulus
 		 */
-		void set_zero()
+		[[nodiscard]] fast_big_integer pow(const fast_big_integer& base, const fast_big_integer& exponent) const
 		{
-			this->bytes_.clear();
-		}
+			constexpr size_t window_size = 16; // 4 bits
 
-		void unsafe_set_back_bit_to(bool value)
-		{
-			this->bytes_.front() |= static_cast<byte>(value);
-		}
+			std::vector<fast_big_integer> table(window_size);
+			table[0] = this->one_;
+			table[1] = this->to_montgomery(base);
 
-		/**
-		 * \brief perform prefix increment
-		 * \return this incremented value
-		 */
-		fast_big_integer& operator ++ ()
-		{
-			if (this->is_zero())
-			{
-				this->bytes_.push_back(1);
-				return *this;
-			}
+			for (size_t i = 2; i < window_size; i++)
+				table[i] = this->multiply(table[i - 1], table[1]);
 
-			auto byte_iterator = this->bytes_.begin();
-			const auto end = this->bytes_.end();
+			fast_big_integer result = this->one_;
+			bool is_first_window = true;
 
-			while (++*byte_iterator == 0)
+			for (size_t i = exponent.bytes_.size() - 1; i != std::numeric_limits<size_t>::max(); i--)
 			{
-				if (++byte_iterator == end)
-					break;
-			}
+				for (const byte window : { static_cast<byte>(exponent.bytes_[i] >> 4), static_cast<byte>(exponent.bytes_[i] & 0x0F) })
+				{
+					if (!is_first_window)
+					{
+						for (size_t j = 0; j < 4; j++)
+							result = this->square(result);
+					}
 
-			if (byte_iterator == end)
-				this->bytes_.push_back(1);
+					if (window != 0)
+					{
+						result = this->multiply(result, table[window]);
+						is_first_window = false;
+					}
+				}
+			}
 
-			return *this;
+			return this->from_montgomery(result);
 		}
-		/**
-		 * \brief perform prefix decrement
-		 * \return this decremented value
-		 */
-		fast_big_integer& operator-- ()
-		{
-			if (this->is_zero())
-				throw std::invalid_argument("number can not be less then zero");
+	};
 
-			auto bytes_iterator = this->bytes_.begin();
+	/**
+	 * \brief result of binary splitting of series over range of terms
+	 */
+	struct fast_big_integer::binary_splitting_sums
+	{
+		fast_big_integer p; // product of p(k)
+		fast_big_integer q; // product of q(k)
+		fast_big_integer t; // absolute value of T, sum of series is T / Q
+		bool is_t_negative = false;
+	};
 
-			if (--*bytes_iterator == 0xFF)
-			{
-				while (*++bytes_iterator == 0)
-					*bytes_iterator = 0xFF;
+	/**
+	 * \brief contains table of base^(d * 2^(i * w)) by modulus for each window i of w bits and each window value d,
+	 * so exponentiation takes one multiplication for each non zero window of exponent and no squarings
+	 */
+	class fast_big_integer::fixed_base_pow
+	{
+		montgomery_context context_;
+		fast_big_integer base_;
 
-				--*bytes_iterator;
-			}
+		size_t window_bits_count_ = 0;
+		size_t max_exponent_bits_count_ = 0;
 
-			if (this->bytes_.back() == 0)
-				this->bytes_.pop_back();
+		// table_[i * (2^w - 1) + d - 1] = base^(d * 2^(i * w)) in Montgomery form
+		std::vector<fast_big_integer> table_;
 
-			return *this;
-		}
+	public:
+		// table of wider windows takes gigabytes for usual moduli
+		static constexpr size_t max_window_bits_count = 8;
 
 		/**
-		 * \brief perform postfix increment
-		 * \return this incremented value
-		 */
-		fast_big_integer& operator ++ (int)
-		{
-			return ++*this;
-		}
-		/**
-		 * \brief perform postfix decrement
-		 * \return this decremented value
+		 * \brief table contains ceil(max_exponent_bits_count / w) * (2^w - 1) residues of modulus size,
+		 * for example 256 windows of 255 residues (about 16 MiB) for 2048 bits modulus and w = 8
+		 * \param base base
+		 * \param modulus odd modulus, greater then one
+		 * \param window_bits_count bits count in window w (from 1 to max_window_bits_count), table contains 2^w - 1 numbers for each window
+		 * \param max_exponent_bits_count max bits count of exponent, which is calculated by table (modulus bits count, when zero)
 		 */
-		fast_big_integer& operator-- (int)
-		{
-			return --*this;
-		}
-
-		fast_big_integer operator + (const fast_big_integer& number) const
-		{
-			return this->sum(number);
-		}
-		fast_big_integer operator - (const fast_big_integer& number) const
-		{
-			return this->difference(number);
-		}
-		fast_big_integer operator * (const fast_big_integer& number) const
-		{
-			return this->product(number);
-		}
-		fast_big_integer operator / (const fast_big_integer& number) const
-		{
-			return this->division(number);
-		}
-		fast_big_integer operator % (const fast_big_integer& number) const
+		fixed_base_pow(const fast_big_integer& base, const fast_big_integer& modulus, const size_t window_bits_count = 4, const size_t max_exponent_bits_count = 0)
+			: context_(modulus), base_(base % modulus), window_bits_count_(window_bits_count),
+			max_exponent_bits_count_(max_exponent_bits_count == 0 ? modulus.bit_length() : max_exponent_bits_count)
 		{
-			fast_big_integer q, r;
-			fast_big_integer::div_classic(*this, number, q, r);
+			if (window_bits_count == 0 || window_bits_count > fixed_base_pow::max_window_bits_count)
+				throw std::invalid_argument("window bits count must be from 1 to 8");
 
-			return r;
-		}
+			const size_t windows_count = (this->max_exponent_bits_count_ + window_bits_count - 1) / window_bits_count;
+			const size_t values_count = (static_cast<size_t>(1) << window_bits_count) - 1;
 
-		fast_big_integer& operator = (const fast_big_integer& number) = default;
+			this->table_.reserve(windows_count * values_count);
 
-		/**
-		 * \param shift_count shift count
-		 * \return shifted to left value
-		 */
-		fast_big_integer operator << (size_t shift_count) const
-		{
-			fast_big_integer copy = *this;
-			copy.fast_shl(shift_count);
+			fast_big_integer window_base = this->context_.to_montgomery(this->base_); // base^(2^(i * w))
 
-			return copy;
-		}
-		/**
-		 * \brief perform shift to left
-		 * \param shift_count shift count
-		 */
-		void operator <<= (size_t shift_count)
-		{
-			this->fast_shl(shift_count);
-		}
-		/**
-		 * \param shift_count shift count
-		 * \return shifted to right value
-		 */
-		fast_big_integer operator >> (size_t shift_count) const
-		{
-			fast_big_integer copy = *this;
-			copy.fast_shr(shift_count);
+			for (size_t i = 0; i < windows_count; i++)
+			{
+				this->table_.push_back(window_base);
 
-			return copy;
-		}
-		/**
-		 * \brief perform shift to right
-		 * \param shift_count shift count
-		 */
-		void operator >>= (size_t shift_count)
-		{
-			this->fast_shr(shift_count);
-		}
+				for (size_t d = 2; d <= values_count; d++)
+					this->table_.push_back(this->context_.multiply(this->table_.back(), window_base));
 
-		/**
-		 * \brief AND operator
-		 * \param number number
-		 * \return result of "AND" operation
-		 */
-		fast_big_integer operator & (const fast_big_integer& number) const
-		{
-			return this-> and (number);
+				window_base = this->context_.multiply(this->table_.back(), window_base);
+			}
 		}
+
 		/**
-		 * \brief OR operator
-		 * \param number number
-		 * \return result of "OR" operation
+		 * \return count of numbers in table
 		 */
-		fast_big_integer operator | (const fast_big_integer& number) const
+		[[nodiscard]] size_t table_size() const
 		{
-			return this-> xor (number);
+			return this->table_.size();
 		}
 		/**
-		 * \brief XOR operator
-		 * \param number number
-		 * \return result of "XOR" operation
+		 * \return modulus of exponentiation
 		 */
-		fast_big_integer operator ^ (const fast_big_integer& number) const
+		[[nodiscard]] const fast_big_integer& modulus() const
 		{
-			return this-> or (number);
+			return this->context_.modulus();
 		}
 
 		/**
-		 * \param exponent exponent
-		 * \return this in power of parameter
+		 * \param exponent exponent (longer exponents then max exponent bits count are calculated without table)
+		 * \return base in power of exponent by modulus
 		 */
 		[[nodiscard]] fast_big_integer pow(const fast_big_integer& exponent) const
 		{
-			if (exponent.is_zero())
-				return fast_big_integer::one();
-			if (exponent.is_one())
-				return *this;
+			const size_t exponent_bits_count = exponent.bit_length();
 
-			fast_big_integer power = exponent;
-			fast_big_integer result = fast_big_integer::one();
-			fast_big_integer x = *this;
+			if (exponent_bits_count > this->max_exponent_bits_count_)
+				return this->context_.pow(this->base_, exponent);
 
-			while (power.is_not_zero())
+			const size_t values_count = (static_cast<size_t>(1) << this->window_bits_count_) - 1;
+
+			fast_big_integer result = this->context_.montgomery_one();
+
+			for (size_t i = 0, bit_index = 0; bit_index < exponent_bits_count; i++, bit_index += this->window_bits_count_)
 			{
-				if (power.is_even())
-				{
-					x = x * x;
-					power >>= 1;
-				}
-				else
-				{
-					result = result * x;
-					x = x * x;
-					--power >>= 1;
-				}
+				const uint32_t window = fast_big_integer::bits_window(exponent, bit_index, this->window_bits_count_);
+
+				if (window != 0)
+					result = this->context_.multiply(result, this->table_[i * values_count + window - 1]);
 			}
 
-			return result;
+			return this->context_.from_montgomery(result);
 		}
-		/**
-		 * \return factorial of this number
-		 */
-		[[nodiscard]] fast_big_integer factorial() const
+	};
+
+	inline fast_big_integer fast_big_integer::extensions::pow_mod(const fast_big_integer& base, const fast_big_integer& exponent, const fast_big_integer& modulus)
+	{
+		if (modulus.is_zero())
+			throw std::invalid_argument("modulus is zero");
+		if (modulus.is_one())
+			return fast_big_integer::zero();
+
+		if (modulus.is_odd())
+			return montgomery_context(modulus).pow(base, exponent);
+
+		// classic square and multiply for even modulus
+		fast_big_integer result = fast_big_integer::one();
+		fast_big_integer x = base % modulus;
+
+		for (size_t i = 0; i < exponent.bytes_.size(); i++)
 		{
-			struct factorial
+			for (byte bits = exponent.bytes_[i], counter = 0; counter < 8; counter++, bits >>= 1)
 			{
-				static fast_big_integer prod_tree(const fast_big_integer& l, const fast_big_integer& r)
-				{
-					if (l > r)
-						return fast_big_integer::one();
-					if (l == r)
-						return l;
-					if ((r - l).is_one())
-						return r * l;
+				if (bits & 1)
+					result = result * x % modulus;
 
-					const fast_big_integer m = l.sum(r) >> 1;
-					const fast_big_integer m_plus_one = m.plus_one();
+				if (bits == 1 && i == exponent.bytes_.size() - 1)
+					break;
 
-					return factorial::prod_tree(l, m) * factorial::prod_tree(m_plus_one, r);
-				}
-			};
+				x = x.square() % modulus;
+			}
+		}
 
-			if (this->is_zero())
-				return fast_big_integer::one();
+		return result;
+	}
 
-			if (this->is_one() || this->is_two())
-				return *this;
+	inline fast_big_integer fast_big_integer::extensions::multi_pow_mod(const std::span<const fast_big_integer> bases,
+		const std::span<const fast_big_integer> exponents, const fast_big_integer& modulus)
+	{
+		// from this bases count buckets are cheaper then tables of powers
+		constexpr size_t pippenger_bases_count = 32;
 
-			return factorial::prod_tree(fast_big_integer::two(), *this);
-		}
-		[[nodiscard]] fast_big_integer factorial_parallel() const
-		{
-			struct factorial_parallel
-			{
-				// calculate tree on one thread
-				static fast_big_integer prod_tree_one_thread(const fast_big_integer& l, const fast_big_integer& r)
-				{
-					if (l > r)
-						return fast_big_integer::one();
-					if (l == r)
-						return l;
-					if ((r - l).is_one())
-						return r * l;
+		if (bases.size() != exponents.size())
+			throw std::invalid_argument("bases and exponents counts are not equal");
+		if (modulus.is_zero())
+			throw std::invalid_argument("modulus is zero");
+		if (modulus.is_one())
+			return fast_big_integer::zero();
 
-					const fast_big_integer m = l.sum(r) >> 1;
-					const fast_big_integer m_plus_one = m.plus_one();
+		if (modulus.is_even())
+		{
+			fast_big_integer result = fast_big_integer::one();
+			for (size_t i = 0; i < bases.size(); i++)
+				result = result * fast_big_integer::extensions::pow_mod(bases[i], exponents[i], modulus) % modulus;
 
-					return factorial_parallel::prod_tree_one_thread(l, m) * factorial_parallel::prod_tree_one_thread(m_plus_one, r);
-				}
+			return result;
+		}
 
-				static std::vector<std::pair<fast_big_integer, fast_big_integer>>
-					split_factorial_tree(const fast_big_integer& l, const fast_big_integer& r, const size_t thread_count)
-				{
-					std::vector<std::pair<fast_big_integer, fast_big_integer>> splitted_tree;
-					splitted_tree.reserve(thread_count);
+		const montgomery_context context(modulus);
 
-					const fast_big_integer step = (r - l) / thread_count;
-					fast_big_integer i = l;
+		if (bases.size() < pippenger_bases_count)
+			return context.from_montgomery(fast_big_integer::extensions::multi_pow_straus(context, bases, exponents, 4));
 
-					do
-					{
-						fast_big_integer next_step_value = i + step;
-#ifdef _MSC_VER
-						splitted_tree.emplace_back(i, next_step_value);
-#elif
-						splitted_tree.push_back(
-							std::make_pair(i, next_step_value)
-						);
-#endif
-						i = next_step_value.plus_one();
-					} while (i < r);
-
-					if (i > r)
-						splitted_tree.back().second = r;
-
-					return splitted_tree;
-				}
+		// about log2(count) bits in window, so buckets count is close to bases count
+		const size_t window_bits_count = std::min<size_t>(16, std::bit_width(bases.size()) - 2);
 
-				static fast_big_integer parallel_prod_tree(const fast_big_integer& l, const fast_big_integer& r)
-				{
-					hpc::thread_pool<fast_big_integer>& thread_pool = hpc::thread_pool<fast_big_integer>::get_instance();
+		return context.from_montgomery(fast_big_integer::extensions::multi_pow_pippenger(context, bases, exponents, window_bits_count));
+	}
 
-					const size_t thread_count = thread_pool.threads_capacity();
+	inline fast_big_integer fast_big_integer::extensions::multi_pow_straus(const montgomery_context& context, const std::span<const fast_big_integer> bases,
+		const std::span<const fast_big_integer> exponents, const size_t window_bits_count)
+	{
+		const size_t values_count = static_cast<size_t>(1) << window_bits_count;
 
-					std::vector<std::future<fast_big_integer>> future_results(thread_count);
+		size_t max_bits_count = 0;
+		for (const fast_big_integer& exponent : exponents)
+			max_bits_count = std::max(max_bits_count, exponent.bit_length());
 
-					auto tree = factorial_parallel::split_factorial_tree(l, r, thread_count);
+		// tables[i * 2^w + d] = bases[i]^d
+		std::vector<fast_big_integer> tables(bases.size() * values_count);
+		for (size_t i = 0; i < bases.size(); i++)
+		{
+			fast_big_integer* table = &tables[i * values_count];
 
-					for (size_t i = 0; i < thread_count; i++)
-					{
-						fast_big_integer& f = tree[i].first;
-						fast_big_integer& s = tree[i].second;
+			table[0] = context.montgomery_one();
+			table[1] = context.to_montgomery(bases[i]);
 
-						future_results[i] = thread_pool.run([&f, &s]()
-						{
-							return factorial_parallel::prod_tree_one_thread(f, s);
-						});
-					}
+			for (size_t d = 2; d < values_count; d++)
+				table[d] = context.multiply(table[d - 1], table[1]);
+		}
 
-					thread_pool.wait_all_jobs();
+		fast_big_integer result = context.montgomery_one();
+		bool is_first_window = true;
 
-					// copy results
-					std::vector<fast_big_integer> numbers_for_mul(thread_count);
-					for (size_t i = 0; i < thread_count; i++)
-						numbers_for_mul[i] = future_results[i].get();
+		for (size_t window_index = (max_bits_count + window_bits_count - 1) / window_bits_count; window_index-- != 0;)
+		{
+			if (!is_first_window)
+			{
+				for (size_t j = 0; j < window_bits_count; j++)
+					result = context.square(result);
+			}
 
-					// clear temporary arrays
-					future_results.clear();
+			for (size_t i = 0; i < bases.size(); i++)
+			{
+				const uint32_t window = fast_big_integer::bits_window(exponents[i], window_index * window_bits_count, window_bits_count);
 
-					// resize
-					future_results.resize(thread_count / 2);
+				if (window != 0)
+				{
+					result = context.multiply(result, tables[i * values_count + window]);
+					is_first_window = false;
+				}
+			}
+		}
 
-					size_t mul_numbers_tree_count = thread_count / 2;
-					while (mul_numbers_tree_count >= 2)
-					{
-						std::vector<fast_big_integer> next_calc_numbers; next_calc_numbers.reserve(mul_numbers_tree_count);
+		return result;
+	}
 
-						for (size_t i = 0; i < numbers_for_mul.size() / 2; i++)
-						{
-							fast_big_integer& f = numbers_for_mul[i * 2];
-							fast_big_integer& s = numbers_for_mul[i * 2 + 1];
+	inline fast_big_integer fast_big_integer::extensions::multi_pow_pippenger(const montgomery_context& context, const std::span<const fast_big_integer> bases,
+		const std::span<const fast_big_integer> exponents, const size_t window_bits_count)
+	{
+		const size_t values_count = static_cast<size_t>(1) << window_bits_count;
 
-							future_results[i] = thread_pool.run([&f, &s]()
-							{
-								return f * s;
-							});
-						}
+		size_t max_bits_count = 0;
+		for (const fast_big_integer& exponent : exponents)
+			max_bits_count = std::max(max_bits_count, exponent.bit_length());
 
-						if (numbers_for_mul.size() % 2 == 1)
-							next_calc_numbers.push_back(numbers_for_mul.back());
+		std::vector<fast_big_integer> montgomery_bases;
+		montgomery_bases.reserve(bases.size());
+		for (const fast_big_integer& base : bases)
+			montgomery_bases.push_back(context.to_montgomery(base));
 
-						thread_pool.wait_all_jobs();
+		std::vector<fast_big_integer> buckets(values_count);
+		std::vector<bool> is_bucket_empty(values_count);
 
-						for (std::future<fast_big_integer>& future_result : future_results)
-							next_calc_numbers.push_back(future_result.get());
+		fast_big_integer result = context.montgomery_one();
+		bool is_first_window = true;
 
-						numbers_for_mul = next_calc_numbers;
+		for (size_t window_index = (max_bits_count + window_bits_count - 1) / window_bits_count; window_index-- != 0;)
+		{
+			if (!is_first_window)
+			{
+				for (size_t j = 0; j < window_bits_count; j++)
+					result = context.square(result);
+			}
 
-						future_results.clear();
+			std::fill(is_bucket_empty.begin(), is_bucket_empty.end(), true);
 
-						future_results.resize(numbers_for_mul.size() / 2);
+			// bucket d is product of bases with window value d
+			for (size_t i = 0; i < bases.size(); i++)
+			{
+				const uint32_t window = fast_big_integer::bits_window(exponents[i], window_index * window_bits_count, window_bits_count);
 
-						mul_numbers_tree_count /= 2;
-					}
+				if (window == 0)
+					continue;
 
-					fast_big_integer result = numbers_for_mul.front() * numbers_for_mul.back();
+				if (is_bucket_empty[window])
+				{
+					buckets[window] = montgomery_bases[i];
+					is_bucket_empty[window] = false;
+				}
+				else
+					buckets[window] = context.multiply(buckets[window], montgomery_bases[i]);
+			}
 
-					//if(numbers_for_mul.size() == 3)
-					//	result = numbers_for_mul[1] * result;
+			// product of bucket[d]^d = product of running products of buckets from the top
+			fast_big_integer running = context.montgomery_one();
+			fast_big_integer window_product = context.montgomery_one();
+			bool is_running_empty = true;
 
-					return result;
+			for (size_t d = values_count - 1; d != 0; d--)
+			{
+				if (!is_bucket_empty[d])
+				{
+					running = is_running_empty ? buckets[d] : context.multiply(running, buckets[d]);
+					is_running_empty = false;
 				}
-			};
 
-			if (this->is_zero())
-				return fast_big_integer::one();
+				if (!is_running_empty)
+					window_product = context.multiply(window_product, running);
+			}
 
-			if (this->is_one() || this->is_two())
-				return *this;
+			if (!is_running_empty)
+			{
+				result = context.multiply(result, window_product);
+				is_first_window = false;
+			}
+		}
 
-			if (this->bytes_.size() == 1 || std::thread::hardware_concurrency() < 2)
-				return this->factorial();
+		return result;
+	}
 
-			return factorial_parallel::parallel_prod_tree(fast_big_integer::two(), *this);
+	inline bool fast_big_integer::extensions::is_probable_prime(const fast_big_integer& n, const uint32_t rounds)
+	{
+		constexpr uint32_t limit = primes::small_primes_limit;
+
+		if (n.bytes_.size() <= sizeof(uint32_t))
+		{
+			const uint32_t value = static_cast<uint32_t>(n.try_to_size_t());
+
+			if (value < limit)
+				return std::binary_search(primes::small_primes.begin(), primes::small_primes.end(), value);
 		}
-		/**
-		 * \return sqrt of this number
-		 */
-		[[nodiscard]] fast_big_integer sqrt() const
+
+		// trial division, primes are grouped so one pass over number serves several primes
+		for (size_t i = 0; i < primes::small_primes.size();)
 		{
-			fast_big_integer x0 = *this;
-			fast_big_integer x1 = *this; ++x1; x1.fast_shr(1);
+			uint64_t group_product = primes::small_primes[i];
+			size_t group_end = i + 1;
 
-			while (x1 < x0)
+			while (group_end < primes::small_primes.size() &&
+				group_product * primes::small_primes[group_end] <= std::numeric_limits<uint32_t>::max())
+				group_product *= primes::small_primes[group_end++];
+
+			const uint32_t rem = fast_big_integer::rem_word(n, static_cast<uint32_t>(group_product));
+
+			for (; i < group_end; i++)
 			{
-				x0 = x1;
-				x1 = x1 + (*this / x1); x1.fast_shr(1);
+				if (rem % primes::small_primes[i] == 0)
+					return false;
 			}
-
-			return x0;
 		}
-		/**
-		 * \param n base
-		 * \return the base n logarithm of this
-		 */
-		[[nodiscard]] fast_big_integer log_n(size_t n) const
+
+		if (n < static_cast<uint64_t>(limit) * limit)
+			return true;
+
+		const montgomery_context context(n);
+
+		if (!fast_big_integer::extensions::miller_rabin(context, fast_big_integer::two()))
+			return false;
+
+		if (!fast_big_integer::extensions::strong_lucas(context))
+			return false;
+
+		for (uint32_t i = 1; i < rounds && i < primes::small_primes.size(); i++)
 		{
-			size_t log = 0u;
-			fast_big_integer tmp_this = *this;
+			if (!fast_big_integer::extensions::miller_rabin(context, static_cast<uint64_t>(primes::small_primes[i])))
+				return false;
+		}
 
-			while (!tmp_this.is_one() && tmp_this.is_not_zero())
-			{
-				++log;
-				
-				if(tmp_this >= n)
-					tmp_this = tmp_this / n;
-				else
-					break;
-			}
+		return true;
+	}
 
-			return log;
+	inline bool fast_big_integer::extensions::miller_rabin(const montgomery_context& context, const fast_big_integer& base)
+	{
+		const fast_big_integer n_minus_one = context.modulus().minus_one();
+		const size_t s = fast_big_integer::trailing_zero_bits(n_minus_one);
+
+		const fast_big_integer one = context.montgomery_one();
+		const fast_big_integer minus_one = context.to_montgomery(n_minus_one);
+
+		fast_big_integer x = context.to_montgomery(context.pow(base, n_minus_one >> s));
+		if (x == one || x == minus_one)
+			return true;
+
+		for (size_t i = 1; i < s; i++)
+		{
+			x = context.square(x);
+
+			if (x == minus_one)
+				return true;
+			if (x == one)
+				return false;
 		}
-		/**
-		 * \return the base two logarithm of this
-		 */
-		[[nodiscard]] fast_big_integer log2() const
+
+		return false;
+	}
+
+	inline bool fast_big_integer::extensions::strong_lucas(const montgomery_context& context)
+	{
+		const fast_big_integer& n = context.modulus();
+		const bool n_is_3_mod_4 = (n.bytes_.front() & 3) == 3;
+
+		// first d in 5, -7, 9, -11, ... with jacobi(d, n) = -1
+		int64_t d = 5;
+		while (true)
 		{
-			uint64_t log = 0u;
-			fast_big_integer tmp_this = *this;
+			const uint64_t d_abs = d < 0 ? -d : d;
 
-			while (!tmp_this.is_one() && tmp_this.is_not_zero())
+			int32_t jacobi = primes::jacobi(fast_big_integer::rem_word(n, static_cast<uint32_t>(d_abs)), d_abs);
+			if ((d_abs & 3) == 3 && n_is_3_mod_4)
+				jacobi = -jacobi; // quadratic reciprocity
+			if (d < 0 && n_is_3_mod_4)
+				jacobi = -jacobi; // (-1 / n)
+
+			if (jacobi == 0)
+				return false;
+			if (jacobi == -1)
+				break;
+
+			// perfect squares have no such d
+			if (d == 13)
 			{
-				++log;
-				tmp_this >>= 1;
+				const fast_big_integer root = n.sqrt();
+				if (root.square() == n)
+					return false;
 			}
 
-			return log;
+			d = d > 0 ? -(d + 2) : -d + 2;
 		}
 
-		[[nodiscard]] fast_big_integer plus_one() const
+		const auto to_montgomery = [&context, &n](const int64_t value)
 		{
-			fast_big_integer copy = *this;
-			return ++copy;
-		}
-		[[nodiscard]] fast_big_integer minus_one() const
+			const fast_big_integer abs_value = static_cast<uint64_t>(value < 0 ? -value : value);
+			return context.to_montgomery(value < 0 ? n - abs_value : abs_value);
+		};
+		const auto half = [&n](fast_big_integer value)
 		{
-			fast_big_integer copy = *this;
-			return --copy;
-		}
+			if (value.is_odd())
+				value.add(n);
 
-		std::strong_ordering operator <=> (const fast_big_integer& n) const
+			value.fast_shr(1);
+			return value;
+		};
+
+		const fast_big_integer d_montgomery = to_montgomery(d);
+		const fast_big_integer q_montgomery = to_montgomery((1 - d) / 4);
+
+		const fast_big_integer n_plus_one = n.plus_one();
+		const size_t s = fast_big_integer::trailing_zero_bits(n_plus_one);
+		const fast_big_integer k = n_plus_one >> s;
+
+		// binary ladder over bits of k, p = 1
+		fast_big_integer u = context.montgomery_one();
+		fast_big_integer v = u;
+		fast_big_integer q_k = q_montgomery;
+
+		byte mask = 0x80;
+		while ((k.bytes_.back() & mask) == 0)
+			mask >>= 1;
+		mask >>= 1;
+
+		for (size_t i = k.bytes_.size() - 1; i != std::numeric_limits<size_t>::max(); i--, mask = 0x80)
 		{
-			return fast_big_integer::compare_optimized(*this, n) <=> 0;
+			for (; mask != 0; mask >>= 1)
+			{
+				u = context.multiply(u, v);
+				v = context.sub(context.square(v), context.add(q_k, q_k));
+				q_k = context.square(q_k);
+
+				if (k.bytes_[i] & mask)
+				{
+					fast_big_integer next_u = half(context.add(u, v));
+					v = half(context.add(context.multiply(d_montgomery, u), v));
+					u = next_u;
+					q_k = context.multiply(q_k, q_montgomery);
+				}
+			}
 		}
-		bool operator == (const fast_big_integer& n) const
+
+		if (u.is_zero() || v.is_zero())
+			return true;
+
+		for (size_t r = 1; r < s; r++)
 		{
-			return fast_big_integer::compare_optimized(*this, n) == 0;
+			v = context.sub(context.square(v), context.add(q_k, q_k));
+			if (v.is_zero())
+				return true;
+
+			q_k = context.square(q_k);
 		}
-		bool operator != (const fast_big_integer& n) const
+
+		return false;
+	}
+
+	template <typename PTerm, typename QTerm, typename ATerm>
+	fast_big_integer::binary_splitting_sums fast_big_integer::extensions::binary_splitting(const uint64_t begin, const uint64_t end,
+		const PTerm& p, const QTerm& q, const ATerm& a, const bool is_alternating)
+	{
+		// ranges which are shorter then this terms count are calculated on one thread
+		constexpr uint64_t parallel_terms_count = 1 << 10;
+
+		if (end - begin == 1)
 		{
-			return fast_big_integer::compare_optimized(*this, n) != 0;
+			binary_splitting_sums leaf{ p(begin), q(begin), fast_big_integer(), false };
+			leaf.t = a(begin) * leaf.p;
+			leaf.is_t_negative = is_alternating && (begin & 1) && leaf.t.is_not_zero();
+
+			return leaf;
 		}
 
-		[[nodiscard]] bool is_equal(const fast_big_integer& value) const
+		const uint64_t middle = begin + (end - begin) / 2;
+
+		if (end - begin < parallel_terms_count || std::thread::hardware_concurrency() < 2)
 		{
-			return fast_big_integer::compare_optimized(*this, value) == 0;
+			return fast_big_integer::extensions::merge_binary_splitting(
+				fast_big_integer::extensions::binary_splitting(begin, middle, p, q, a, is_alternating),
+				fast_big_integer::extensions::binary_splitting(middle, end, p, q, a, is_alternating));
 		}
-		[[nodiscard]] bool is_not_equal(const fast_big_integer& value) const
+
+		hpc::thread_pool<binary_splitting_sums>& thread_pool = hpc::thread_pool<binary_splitting_sums>::get_instance();
+
+		std::future<binary_splitting_sums> right_result = thread_pool.run([middle, end, &p, &q, &a, is_alternating]()
 		{
-			return fast_big_integer::compare_optimized(*this, value) != 0;
+			return fast_big_integer::extensions::binary_splitting(middle, end, p, q, a, is_alternating);
+		});
+
+		const binary_splitting_sums left = fast_big_integer::extensions::binary_splitting(begin, middle, p, q, a, is_alternating);
+
+		return fast_big_integer::extensions::merge_binary_splitting(left, thread_pool.wait_and_help(right_result));
+	}
+
+	inline fast_big_integer::binary_splitting_sums fast_big_integer::extensions::merge_binary_splitting(const binary_splitting_sums& left, const binary_splitting_sums& right)
+	{
+		binary_splitting_sums result{ left.p * right.p, left.q * right.q, fast_big_integer(), false };
+
+		const fast_big_integer left_t = left.t * right.q;
+		const fast_big_integer right_t = left.p * right.t;
+
+		if (left.is_t_negative == right.is_t_negative)
+		{
+			result.t = left_t + right_t;
+			result.is_t_negative = left.is_t_negative;
 		}
-		[[nodiscard]] bool is_letter_then(const fast_big_integer& value) const
+		else if (left_t >= right_t)
 		{
-			return fast_big_integer::compare_optimized(*this, value) == -1;
+			result.t = left_t - right_t;
+			result.is_t_negative = left.is_t_negative;
 		}
-		[[nodiscard]] bool is_greater_then(const fast_big_integer& value) const
+		else
 		{
-			return fast_big_integer::compare_optimized(*this, value) == 1;
+			result.t = right_t - left_t;
+			result.is_t_negative = right.is_t_negative;
 		}
-	};
-}
\ No newline at end of file
+
+		if (result.t.is_zero())
+			result.is_t_negative = false;
+
+		return result;
+	}
+
+	inline fast_big_integer fast_big_integer::extensions::pi(const size_t digits)
+	{
+		// each term adds about 14.18 decimal digits, guard digits cover truncation of square root
+		constexpr double digits_per_term = 14.181647462725477;
+		constexpr size_t guard_digits = 10;
+
+		const uint64_t terms_count = static_cast<uint64_t>(static_cast<double>(digits + guard_digits) / digits_per_term) + 2;
+
+		// pi = 426880 * sqrt(10005) / S, S = sum of (-1)^k * (13591409 + 545140134k) * p(1)...p(k) / (q(1)...q(k))
+		const fast_big_integer c3_over_24 = static_cast<uint64_t>(10939058860032000); // 640320^3 / 24
+
+		const binary_splitting_sums sums = fast_big_integer::extensions::binary_splitting(0, terms_count,
+			[](const uint64_t k) -> fast_big_integer
+			{
+				if (k == 0)
+					return fast_big_integer::one();
+
+				return fast_big_integer(6 * k - 5) * fast_big_integer(2 * k - 1) * fast_big_integer(6 * k - 1);
+			},
+			[&c3_over_24](const uint64_t k) -> fast_big_integer
+			{
+				if (k == 0)
+					return fast_big_integer::one();
+
+				const fast_big_integer big_k = k;
+				return big_k * big_k * big_k * c3_over_24;
+			},
+			[](const uint64_t k) -> fast_big_integer
+			{
+				return fast_big_integer(static_cast<uint64_t>(545140134) * k + 13591409);
+			},
+			true);
+
+		const fast_big_integer scale = fast_big_integer(10).pow(static_cast<uint64_t>(digits + guard_digits));
+		const fast_big_integer sqrt_10005 = (fast_big_integer(10005) * scale.square()).sqrt();
+
+		return fast_big_integer(426880) * sqrt_10005 * sums.q / sums.t / fast_big_integer(10).pow(static_cast<uint64_t>(guard_digits));
+	}
+
+	inline fast_big_integer fast_big_integer::extensions::e(const size_t digits)
+	{
+		// the first skipped term 1 / n! must be less then 10^-digits
+		uint64_t terms_count = 1;
+		for (double log10_factorial = 0; log10_factorial <= static_cast<double>(digits) + 1; terms_count++)
+			log10_factorial += std::log10(static_cast<double>(terms_count));
+
+		const binary_splitting_sums sums = fast_big_integer::extensions::binary_splitting(0, terms_count,
+			[](const uint64_t) -> fast_big_integer
+			{
+				return fast_big_integer::one();
+			},
+			[](const uint64_t k) -> fast_big_integer
+			{
+				return k == 0 ? fast_big_integer::one() : fast_big_integer(k);
+			},
+			[](const uint64_t) -> fast_big_integer
+			{
+				return fast_big_integer::one();
+			});
+
+		return sums.t * fast_big_integer(10).pow(static_cast<uint64_t>(digits)) / sums.q;
+	}
+}
+
+template <>
+struct std::hash<::numbers::fast_big_integer_view>
+{
+	size_t operator()(const ::numbers::fast_big_integer_view number) const noexcept
+	{
+		return number.hash();
+	}
+};
+
+template <>
+struct std::hash<::numbers::fast_big_integer>
+{
+	size_t operator()(const ::numbers::fast_big_integer& number) const noexcept
+	{
+		return number.hash();
+	}
+};
@@ -0,0 +1,61 @@
+﻿#pragma once
+
+#include "fast_big_integer.h" // use for fast_big_integer
+#include "modules/io/mapped_file.h" // use for memory mapped files
+
+// opt-in support of memory mapped numbers, it includes os headers for file mapping
+
+namespace numbers
+{
+	/**
+	 * \brief read only number in file written by save, bytes are not copied and pages of file
+	 * are loaded by os on first access
+	 */
+	class fast_big_integer::mapped_number
+	{
+		io::mapped_file file_;
+
+	public:
+		/**
+		 * \param path file written by save
+		 * \param is_checksum_checked if all bytes are read to check checksum -> true, else -> false
+		 */
+		explicit mapped_number(const std::string& path, const bool is_checksum_checked = true) : file_(path)
+		{
+			if (this->file_.size() < fast_big_integer::file_header_size)
+				throw std::invalid_argument("incorrect file");
+
+			uint64_t bytes_count, checksum;
+			fast_big_integer::read_file_header(reinterpret_cast<const byte*>(this->file_.data()), this->file_.size(), bytes_count, checksum);
+
+			const std::span<const std::byte> number_bytes = this->bytes();
+
+			if (!number_bytes.empty() && number_bytes.back() == std::byte{ 0 })
+				throw std::invalid_argument("incorrect file");
+
+			if (is_checksum_checked && fast_big_integer::file_checksum(reinterpret_cast<const byte*>(number_bytes.data()), number_bytes.size()) != checksum)
+				throw std::invalid_argument("incorrect file");
+		}
+		/**
+		 * \return little endian bytes of number in mapped pages
+		 */
+		[[nodiscard]] std::span<const std::byte> bytes() const
+		{
+			return { this->file_.data() + fast_big_integer::file_header_size, this->file_.size() - fast_big_integer::file_header_size };
+		}
+		/**
+		 * \return view of number in mapped pages
+		 */
+		[[nodiscard]] fast_big_integer_view view() const
+		{
+			return fast_big_integer_view(this->bytes());
+		}
+		/**
+		 * \return owning copy of number
+		 */
+		[[nodiscard]] fast_big_integer to_number() const
+		{
+			return fast_big_integer::import_from(this->bytes());
+		}
+	};
+}
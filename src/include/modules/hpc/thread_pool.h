@@ -6,6 +6,7 @@
 #include <vector>
 #include <functional>
 #include <mutex>
+#include <chrono>
 
 #include "concurrency/concurrency_queue.h"
 
@@ -37,32 +38,9 @@ namespace hpc
 					if(task == nullptr)
 						continue;
 
-					task->second->set_value(task->first());
-					delete task->second;
-					delete task;
-
-					thp->condition_.notify_one();
+					thp->perform_task(task);
 				}
 			}
-
-			static uint32_t next_power_of_2(uint32_t n)
-			{
-				const auto tmp = n;
-				
-				n--;
-				n |= n >> 1;
-				n |= n >> 2;
-				n |= n >> 4;
-				n |= n >> 8;
-				n |= n >> 16;
-				n++;
-
-				// maybe this is faster way for 3, 6, 10 and etc cores, but i don't now
-				//if (tmp < n)
-					//n >>= 1;
-				
-				return n;
-			}
 		};
 
 		std::vector<std::thread> threads_; // threads for performing
@@ -75,10 +53,32 @@ namespace hpc
 
 		bool is_in_closing_ = false;
 
+		// exception of job is stored in its future, so it never escapes to thread, which has taken job,
+		// waiting threads are notified under lock, so readiness of their futures is not missed
+		void perform_task(std::pair<std::function<TasksRetT()>, std::promise<TasksRetT>*>* task)
+		{
+			try
+			{
+				task->second->set_value(task->first());
+			}
+			catch (...)
+			{
+				task->second->set_exception(std::current_exception());
+			}
+
+			delete task->second;
+			delete task;
+
+			{
+				std::unique_lock<std::mutex> lock(this->locker_);
+			}
+			this->condition_.notify_all();
+		}
+
 		explicit thread_pool(const uint32_t threads_capacity = std::thread::hardware_concurrency())
 		{
 			// init base
-			this->threads_count_ = thread_util::next_power_of_2(threads_capacity);
+			this->threads_count_ = threads_capacity == 0 ? 1 : threads_capacity;
 			this->threads_.resize(threads_count_);
 
 			// init threads
@@ -112,6 +112,37 @@ namespace hpc
 			return (*p).get_future();
 		}
 
+		// perform queued jobs on current thread while result is not ready,
+		// so jobs can wait for results of their child jobs without deadlock,
+		// thread sleeps while queue is empty
+		TasksRetT wait_and_help(std::future<TasksRetT>& future)
+		{
+			const auto is_ready = [&future]()
+			{
+				return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+			};
+
+			while (!is_ready())
+			{
+				std::pair<std::function<TasksRetT()>, std::promise<TasksRetT>*>* task = this->tasks_queue_.concurrent_pop();
+
+				if (task == nullptr)
+				{
+					std::unique_lock<std::mutex> lock(this->locker_);
+					this->condition_.wait(lock, [this, &is_ready]()
+					{
+						return !this->tasks_queue_.empty() || is_ready();
+					});
+
+					continue;
+				}
+
+				this->perform_task(task);
+			}
+
+			return future.get();
+		}
+
 		void wait_all_jobs()
 		{
 			{
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <stdexcept>
+
+#ifdef _WIN32
+// only core api is needed, macro is not left defined for including translation unit
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define IO_MAPPED_FILE_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#ifdef IO_MAPPED_FILE_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef IO_MAPPED_FILE_LEAN_AND_MEAN
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace io
+{
+	// read only view of whole file, pages are loaded by os on first access
+	class mapped_file
+	{
+		const std::byte* data_ = nullptr;
+		size_t size_ = 0;
+
+#ifdef _WIN32
+		HANDLE file_ = INVALID_HANDLE_VALUE;
+		HANDLE mapping_ = nullptr;
+#else
+		int file_ = -1;
+#endif
+
+		void close()
+		{
+#ifdef _WIN32
+			if (this->data_ != nullptr)
+				UnmapViewOfFile(this->data_);
+			if (this->mapping_ != nullptr)
+				CloseHandle(this->mapping_);
+			if (this->file_ != INVALID_HANDLE_VALUE)
+				CloseHandle(this->file_);
+
+			this->file_ = INVALID_HANDLE_VALUE;
+			this->mapping_ = nullptr;
+#else
+			if (this->data_ != nullptr)
+				munmap(const_cast<std::byte*>(this->data_), this->size_);
+			if (this->file_ != -1)
+				::close(this->file_);
+
+			this->file_ = -1;
+#endif
+			this->data_ = nullptr;
+			this->size_ = 0;
+		}
+
+	public:
+		explicit mapped_file(const std::string& path)
+		{
+#ifdef _WIN32
+			this->file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (this->file_ == INVALID_HANDLE_VALUE)
+				throw std::invalid_argument("can not open file");
+
+			LARGE_INTEGER file_size;
+			if (!GetFileSizeEx(this->file_, &file_size))
+			{
+				this->close();
+				throw std::invalid_argument("can not open file");
+			}
+
+			this->size_ = static_cast<size_t>(file_size.QuadPart);
+			if (this->size_ == 0)
+				return;
+
+			this->mapping_ = CreateFileMappingA(this->file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (this->mapping_ != nullptr)
+				this->data_ = static_cast<const std::byte*>(MapViewOfFile(this->mapping_, FILE_MAP_READ, 0, 0, 0));
+#else
+			this->file_ = open(path.c_str(), O_RDONLY);
+			if (this->file_ == -1)
+				throw std::invalid_argument("can not open file");
+
+			struct stat file_status;
+			if (fstat(this->file_, &file_status) != 0)
+			{
+				this->close();
+				throw std::invalid_argument("can not open file");
+			}
+
+			this->size_ = static_cast<size_t>(file_status.st_size);
+			if (this->size_ == 0)
+				return;
+
+			void* data = mmap(nullptr, this->size_, PROT_READ, MAP_SHARED, this->file_, 0);
+			if (data != MAP_FAILED)
+				this->data_ = static_cast<const std::byte*>(data);
+#endif
+			if (this->data_ == nullptr)
+			{
+				this->close();
+				throw std::invalid_argument("can not map file");
+			}
+		}
+
+		mapped_file(const mapped_file&) = delete;
+		mapped_file& operator=(const mapped_file&) = delete;
+
+		mapped_file(mapped_file&& other) noexcept
+			: data_(other.data_), size_(other.size_), file_(other.file_)
+#ifdef _WIN32
+			, mapping_(other.mapping_)
+#endif
+		{
+			other.data_ = nullptr;
+			other.size_ = 0;
+#ifdef _WIN32
+			other.file_ = INVALID_HANDLE_VALUE;
+			other.mapping_ = nullptr;
+#else
+			other.file_ = -1;
+#endif
+		}
+
+		~mapped_file()
+		{
+			this->close();
+		}
+
+		[[nodiscard]] const std::byte* data() const
+		{
+			return this->data_;
+		}
+
+		[[nodiscard]] size_t size() const
+		{
+			return this->size_;
+		}
+	};
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+namespace primes
+{
+	// marks composite numbers which are less then limit (sieve of eratosthenes)
+	template <uint32_t Limit>
+	constexpr std::array<bool, Limit> make_composites_table()
+	{
+		std::array<bool, Limit> is_composite{};
+
+		for (uint32_t n = 2; n * n < Limit; n++)
+		{
+			if (is_composite[n])
+				continue;
+
+			for (uint32_t m = n * n; m < Limit; m += n)
+				is_composite[m] = true;
+		}
+
+		return is_composite;
+	}
+
+	// count of primes which are less then limit
+	template <uint32_t Limit>
+	constexpr uint32_t primes_count()
+	{
+		const std::array<bool, Limit> is_composite = make_composites_table<Limit>();
+		uint32_t count = 0;
+
+		for (uint32_t n = 2; n < Limit; n++)
+			count += !is_composite[n];
+
+		return count;
+	}
+
+	// all primes which are less then limit, computed at compile time
+	template <uint32_t Limit>
+	constexpr std::array<uint32_t, primes_count<Limit>()> make_primes_table()
+	{
+		const std::array<bool, Limit> is_composite = make_composites_table<Limit>();
+		std::array<uint32_t, primes_count<Limit>()> table{};
+
+		size_t index = 0;
+		for (uint32_t n = 2; n < Limit; n++)
+		{
+			if (!is_composite[n])
+				table[index++] = n;
+		}
+
+		return table;
+	}
+
+	// small primes for trial division and sieving
+	constexpr uint32_t small_primes_limit = 2048;
+	inline constexpr auto small_primes = make_primes_table<small_primes_limit>();
+
+	// all primes which are less or equal to limit (sieve of eratosthenes over odd numbers)
+	inline std::vector<uint32_t> sieve(const uint32_t limit)
+	{
+		std::vector<uint32_t> result;
+		if (limit < 2)
+			return result;
+
+		result.push_back(2);
+
+		// index i is odd number 2 * i + 1
+		const size_t odd_count = (static_cast<size_t>(limit) - 1) / 2 + 1;
+		std::vector<bool> is_composite(odd_count);
+
+		for (size_t i = 1; static_cast<uint64_t>(2 * i + 1) * (2 * i + 1) <= limit; i++)
+		{
+			if (is_composite[i])
+				continue;
+
+			const size_t p = 2 * i + 1;
+			for (size_t j = p * p / 2; j < odd_count; j += p)
+				is_composite[j] = true;
+		}
+
+		for (size_t i = 1; i < odd_count; i++)
+		{
+			if (!is_composite[i])
+				result.push_back(static_cast<uint32_t>(2 * i + 1));
+		}
+
+		return result;
+	}
+
+	// jacobi symbol (a / n), n is odd
+	constexpr int32_t jacobi(uint64_t a, uint64_t n)
+	{
+		int32_t result = 1;
+		a %= n;
+
+		while (a != 0)
+		{
+			while ((a & 1) == 0)
+			{
+				a >>= 1;
+
+				const uint64_t n_mod_8 = n & 7;
+				if (n_mod_8 == 3 || n_mod_8 == 5)
+					result = -result;
+			}
+
+			const uint64_t tmp = a; a = n; n = tmp;
+
+			if ((a & 3) == 3 && (n & 3) == 3)
+				result = -result;
+
+			a %= n;
+		}
+
+		return n == 1 ? result : 0;
+	}
+}
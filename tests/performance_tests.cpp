@@ -227,6 +227,127 @@ public:
 		cout << endl;
 	}
 
+	static void is_probable_prime_test(const int repeat = 10)
+	{
+		const function init_number = [](fast_big_integer& number)
+		{
+			number = fast_big_integer::extensions::pow2(521).minus_one(); // mersenne prime
+		};
+
+		const function is_probable_prime_benchmark = [](const fast_big_integer& number)
+		{
+			bool is_prime = fast_big_integer::extensions::is_probable_prime(number, 5);
+			is_prime = !is_prime;
+		};
+
+		const performance_test<void, fast_big_integer> is_probable_prime
+		(
+			is_probable_prime_benchmark,
+			init_number,
+			"is_probable_prime_test",
+			repeat,
+			5
+		);
+
+		const benchmark_info info = is_probable_prime.perform();
+
+		iostream console(cout.rdbuf());
+		is_probable_prime.print_performance_test_info_to_stream(console, info);
+
+		cout << endl;
+	}
+
+	static void pi_test(const int repeat = 10)
+	{
+		const function init_digits = [](size_t& digits)
+		{
+			digits = 10'000;
+		};
+
+		const function pi_benchmark = [](const size_t& digits)
+		{
+			size_t bit_count = fast_big_integer::extensions::pi(digits).num_bits();
+			bit_count++;
+		};
+
+		const performance_test<void, size_t> pi
+		(
+			pi_benchmark,
+			init_digits,
+			"pi_test",
+			repeat,
+			5
+		);
+
+		const benchmark_info info = pi.perform();
+
+		iostream console(cout.rdbuf());
+		pi.print_performance_test_info_to_stream(console, info);
+
+		cout << endl;
+	}
+
+	static void e_test(const int repeat = 10)
+	{
+		const function init_digits = [](size_t& digits)
+		{
+			digits = 10'000;
+		};
+
+		const function e_benchmark = [](const size_t& digits)
+		{
+			size_t bit_count = fast_big_integer::extensions::e(digits).num_bits();
+			bit_count++;
+		};
+
+		const performance_test<void, size_t> e
+		(
+			e_benchmark,
+			init_digits,
+			"e_test",
+			repeat,
+			5
+		);
+
+		const benchmark_info info = e.perform();
+
+		iostream console(cout.rdbuf());
+		e.print_performance_test_info_to_stream(console, info);
+
+		cout << endl;
+	}
+
+	static void hex_test(const int repeat = 10)
+	{
+		const function init_number = [](fast_big_integer& number)
+		{
+			number = fast_big_integer(3).pow(1'000'000);
+		};
+
+		const function hex_benchmark = [](const fast_big_integer& number)
+		{
+			const std::string hex = number.to_string_hex();
+			size_t bit_count = fast_big_integer::extensions::create_from_hex(hex).num_bits();
+			bit_count++;
+		};
+
+		const performance_test<void, fast_big_integer> hex
+		(
+			hex_benchmark,
+			init_number,
+			"hex_test",
+			repeat,
+			5
+		);
+
+		const benchmark_info info = hex.perform();
+
+		iostream console(cout.rdbuf());
+		hex.print_performance_test_info_to_stream(console, info);
+
+		cout << endl;
+	}
+
 	static void perform_all_tests()
 	{
 		whole_number_tests::sqrt_test();
@@ -236,6 +357,10 @@ public:
 		whole_number_tests::factorial_parallel_test();
 		whole_number_tests::gcd_test();
 		whole_number_tests::lcm_test();
+		whole_number_tests::is_probable_prime_test();
+		whole_number_tests::pi_test();
+		whole_number_tests::e_test();
+		whole_number_tests::hex_test();
 
 		cout << "tests was ended" << endl;
 	}
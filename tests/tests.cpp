@@ -1,8 +1,13 @@
 #if defined TESTING_ENABLED && !defined PERFORMANCE_TESTING_ENABLED
 
 #include <iostream>
+#include <filesystem>
+#include <sstream>
+#include <iomanip>
+#include <unordered_set>
 #include <gtest/gtest.h>
 #include <include/fast_big_integer.h>
+#include <include/fast_big_integer_mapped_file.h>
 
 using namespace std;
 using namespace numbers;
@@ -47,4 +52,650 @@ TEST(Arithmetic, Division)
 	ASSERT_EQ(sum.to_string(), "691441");
 }
 
+TEST(Arithmetic, DivisionSmallDividend)
+{
+	const fast_big_integer a = "712394561245";
+	const fast_big_integer b = "492579453412394583";
+
+	fast_big_integer rem;
+	const fast_big_integer quotient = a.division_reminder(b, rem);
+
+	ASSERT_TRUE(quotient.is_zero());
+	ASSERT_EQ(rem.to_string(), "712394561245");
+}
+
+TEST(Extensions, Xgcd)
+{
+	const fast_big_integer a = "94268994258938412899835384830325634925939491824981248";
+	const fast_big_integer b = "39659214656723773994969923999239997777";
+
+	fast_big_integer s, t;
+	const fast_big_integer g = fast_big_integer::extensions::xgcd(a, b, s, t);
+
+	ASSERT_EQ(g, fast_big_integer::extensions::gcd(a, b));
+	ASSERT_EQ(a * s - b * t, g);
+}
+
+TEST(Extensions, ModInverse)
+{
+	const fast_big_integer a = "492579453412394583";
+	const fast_big_integer m = "712394561245";
+
+	const fast_big_integer inverse = fast_big_integer::extensions::mod_inverse(a, m);
+
+	ASSERT_TRUE((a * inverse % m).is_one());
+	ASSERT_THROW(fast_big_integer::extensions::mod_inverse(10, 25), std::invalid_argument);
+}
+
+TEST(Extensions, PowMod)
+{
+	const fast_big_integer base = "492579453412394583";
+	const fast_big_integer exponent = "712394561245";
+
+	ASSERT_EQ(fast_big_integer::extensions::pow_mod(base, exponent, 1000000007).to_string(), "396157332");
+	ASSERT_EQ(fast_big_integer::extensions::pow_mod(base, exponent, 1000000000).to_string(), "278362743");
+}
+
+TEST(Extensions, IsProbablePrime)
+{
+	const fast_big_integer mersenne_127 = fast_big_integer::extensions::pow2(127).minus_one();
+	const fast_big_integer mersenne_89 = fast_big_integer::extensions::pow2(89).minus_one();
+
+	ASSERT_TRUE(fast_big_integer::extensions::is_probable_prime(mersenne_127));
+	ASSERT_TRUE(fast_big_integer::extensions::is_probable_prime(mersenne_89, 8));
+	ASSERT_FALSE(fast_big_integer::extensions::is_probable_prime(mersenne_127 * mersenne_89));
+
+	// strong pseudoprime to bases 2, 3, 5 and 7
+	ASSERT_FALSE(fast_big_integer::extensions::is_probable_prime(static_cast<fast_big_integer>("3215031751")));
+}
+
+TEST(Extensions, NextPrime)
+{
+	const fast_big_integer n = "100000000000000000000";
+
+	ASSERT_EQ(fast_big_integer::extensions::next_prime(n).to_string(), "100000000000000000039");
+	ASSERT_EQ(fast_big_integer::extensions::next_prime(1000).to_string(), "1009");
+
+	const fast_big_integer large = fast_big_integer(10).pow(300);
+	ASSERT_EQ(fast_big_integer::extensions::next_prime_parallel(large), fast_big_integer::extensions::next_prime(large));
+}
+
+TEST(Extensions, RandomPrime)
+{
+	const fast_big_integer prime = fast_big_integer::extensions::random_prime(256);
+
+	ASSERT_TRUE(prime >= fast_big_integer::extensions::pow2(255));
+	ASSERT_TRUE(prime < fast_big_integer::extensions::pow2(256));
+	ASSERT_TRUE(fast_big_integer::extensions::is_probable_prime(prime, 8));
+}
+
+TEST(Extensions, BatchGcd)
+{
+	const std::vector<fast_big_integer> moduli = { 3 * 5, 7 * 11, 5 * 13, 17 * 19, 19 * 23 };
+
+	const std::vector<fast_big_integer> gcds = fast_big_integer::extensions::batch_gcd(moduli);
+
+	ASSERT_EQ(gcds.size(), moduli.size());
+	ASSERT_EQ(gcds[0], 5);
+	ASSERT_TRUE(gcds[1].is_one());
+	ASSERT_EQ(gcds[2], 5);
+	ASSERT_EQ(gcds[3], 19);
+	ASSERT_EQ(gcds[4], 19);
+}
+
+TEST(Extensions, ProductAndRemainderTree)
+{
+	const std::vector<fast_big_integer> numbers = { 7, 11, 13, 1000000007, 998244353 };
+	const fast_big_integer x = "492579453412394583712394561245";
+
+	const std::vector<std::vector<fast_big_integer>> tree = fast_big_integer::extensions::product_tree(numbers);
+	const std::vector<fast_big_integer> remainders = fast_big_integer::extensions::remainder_tree(x, tree);
+
+	ASSERT_EQ(tree.back().front(), fast_big_integer::extensions::product(numbers));
+	ASSERT_EQ(tree.back().front().to_string(), "999242604347698181471");
+
+	for (size_t i = 0; i < numbers.size(); i++)
+		ASSERT_EQ(remainders[i], x % numbers[i]);
+}
+
+TEST(Arithmetic, Factorial)
+{
+	const fast_big_integer n = 30;
+
+	ASSERT_EQ(n.factorial().to_string(), "265252859812191058636308480000000");
+	ASSERT_EQ(fast_big_integer::extensions::factorial(static_cast<uint64_t>(1000)), static_cast<fast_big_integer>(1000).factorial_parallel());
+
+	// about 250000 bits, so product is split between jobs of thread pool
+	ASSERT_EQ(fast_big_integer::extensions::factorial(static_cast<uint64_t>(20000)), static_cast<fast_big_integer>(20000).factorial_parallel());
+	ASSERT_TRUE(fast_big_integer::zero().factorial().is_one());
+}
+
+TEST(Extensions, ParallelProductAndSum)
+{
+	std::vector<fast_big_integer> numbers;
+	for (int32_t i = 1; i <= 100; i++)
+		numbers.emplace_back(i);
+
+	ASSERT_EQ(fast_big_integer::extensions::parallel_product(numbers), static_cast<fast_big_integer>(100).factorial());
+	ASSERT_EQ(fast_big_integer::extensions::parallel_sum(numbers).to_string(), "5050");
+}
+
+TEST(Extensions, BinomialAndMultinomial)
+{
+	const std::vector<uint64_t> counts = { 3, 5, 7, 2 };
+
+	ASSERT_EQ(fast_big_integer::extensions::binomial(100, 50).to_string(), "100891344545564193334812497256");
+	ASSERT_TRUE(fast_big_integer::extensions::binomial(10, 11).is_zero());
+	ASSERT_EQ(fast_big_integer::extensions::multinomial(counts).to_string(), "49008960");
+}
+
+TEST(Arithmetic, Square)
+{
+	for (const size_t size : { 1, 7, 16, 33, 100 })
+	{
+		const fast_big_integer x = fast_big_integer::extensions::random_sizeof(size);
+
+		ASSERT_EQ(x.square(), x * x);
+	}
+
+	ASSERT_TRUE(fast_big_integer::zero().square().is_zero());
+}
+
+TEST(Extensions, FibonacciAndLucas)
+{
+	ASSERT_EQ(fast_big_integer::extensions::fibonacci(100).to_string(), "354224848179261915075");
+	ASSERT_EQ(fast_big_integer::extensions::fibonacci(300).to_string(), "222232244629420445529739893461909967206666939096499764990979600");
+	ASSERT_TRUE(fast_big_integer::extensions::fibonacci(0).is_zero());
+	ASSERT_EQ(fast_big_integer::extensions::lucas(10).to_string(), "123");
+	ASSERT_EQ(fast_big_integer::extensions::lucas(100).to_string(), "792070839848372253127");
+}
+
+TEST(Extensions, NthRoot)
+{
+	const fast_big_integer x = "1000000000000000000000000000005";
+	fast_big_integer remainder;
+
+	ASSERT_EQ(fast_big_integer::extensions::nth_root(x, 3, remainder).to_string(), "10000000000");
+	ASSERT_EQ(remainder.to_string(), "5");
+
+	for (const uint64_t k : { 2, 5, 17 })
+	{
+		const fast_big_integer y = fast_big_integer::extensions::random_sizeof(64);
+		const fast_big_integer root = fast_big_integer::extensions::nth_root(y, k, remainder);
+
+		ASSERT_EQ(root.pow(k) + remainder, y);
+		ASSERT_GT(root.plus_one().pow(k), y);
+	}
+
+	// degree is not less then bit length, so root is one
+	ASSERT_TRUE(fast_big_integer::extensions::nth_root(1000, 1'000'000'000'000, remainder).is_one());
+	ASSERT_EQ(remainder, 999);
+	ASSERT_TRUE(fast_big_integer::extensions::nth_root(1023, 10).is_one());
+	ASSERT_EQ(fast_big_integer::extensions::nth_root(1024, 10), 2);
+
+	// large degree, first estimations of root are too large for power
+	const fast_big_integer z = fast_big_integer(3).pow(1000);
+	ASSERT_EQ(fast_big_integer::extensions::nth_root(z, 1000, remainder), 3);
+	ASSERT_TRUE(remainder.is_zero());
+}
+
+TEST(Extensions, IsPerfectPower)
+{
+	fast_big_integer base;
+	uint64_t exponent = 0;
+
+	ASSERT_TRUE(fast_big_integer::extensions::is_perfect_power(fast_big_integer(12).pow(10), base, exponent));
+	ASSERT_EQ(base.to_string(), "12");
+	ASSERT_EQ(exponent, 10u);
+
+	ASSERT_TRUE(fast_big_integer::extensions::is_perfect_power(fast_big_integer(3).pow(40), base, exponent));
+	ASSERT_EQ(base.to_string(), "3");
+	ASSERT_EQ(exponent, 40u);
+
+	ASSERT_FALSE(fast_big_integer::extensions::is_perfect_power(fast_big_integer(3).pow(40).plus_one(), base, exponent));
+	ASSERT_EQ(exponent, 1u);
+}
+
+TEST(Arithmetic, SqrtRem)
+{
+	const fast_big_integer x = "123456789012345678901234567890123456789";
+	fast_big_integer remainder;
+
+	ASSERT_EQ(x.sqrtrem(remainder).to_string(), "11111111061111110993");
+	ASSERT_EQ(remainder.to_string(), "13580235091358010740");
+
+	for (const size_t size : { 1, 8, 30, 300 })
+	{
+		const fast_big_integer y = fast_big_integer::extensions::random_sizeof(size);
+		const fast_big_integer root = y.sqrtrem(remainder);
+
+		ASSERT_EQ(root.square() + remainder, y);
+		ASSERT_GT(root.plus_one().square(), y);
+	}
+}
+
+TEST(Arithmetic, ShiftLongNumber)
+{
+	const fast_big_integer x = fast_big_integer::extensions::random_sizeof(300);
+
+	ASSERT_EQ(x >> 13, x / fast_big_integer::extensions::pow2(13));
+	ASSERT_EQ(x << 13, x * fast_big_integer::extensions::pow2(13));
+}
+
+TEST(Extensions, BinarySplitting)
+{
+	// 1 - 1/2 + 1/4 = 3/4
+	const auto sums = fast_big_integer::extensions::binary_splitting(0, 3,
+		[](const uint64_t) { return fast_big_integer::one(); },
+		[](const uint64_t k) { return k == 0 ? fast_big_integer::one() : fast_big_integer(2); },
+		[](const uint64_t) { return fast_big_integer::one(); },
+		true);
+
+	ASSERT_EQ(sums.q.to_string(), "4");
+	ASSERT_EQ(sums.t.to_string(), "3");
+	ASSERT_FALSE(sums.is_t_negative);
+}
+
+TEST(Extensions, PiAndE)
+{
+	ASSERT_EQ(fast_big_integer::extensions::pi(50).to_string(), "314159265358979323846264338327950288419716939937510");
+	ASSERT_EQ(fast_big_integer::extensions::e(50).to_string(), "271828182845904523536028747135266249775724709369995");
+}
+
+TEST(Extensions, FixedBasePow)
+{
+	const fast_big_integer modulus = fast_big_integer::extensions::pow2(521).minus_one();
+	const fast_big_integer base = fast_big_integer::extensions::random_sizeof(64);
+
+	for (const size_t window_bits_count : { 1, 4, 7 })
+	{
+		const fast_big_integer::fixed_base_pow fixed_base(base, modulus, window_bits_count);
+
+		for (size_t i = 0; i < 4; i++)
+		{
+			const fast_big_integer exponent = fast_big_integer::extensions::random_sizeof(60 + i);
+
+			ASSERT_EQ(fixed_base.pow(exponent), fast_big_integer::extensions::pow_mod(base, exponent, modulus));
+		}
+	}
+
+	// exponent is longer then table
+	const fast_big_integer::fixed_base_pow small_table(base, modulus, 4, 64);
+	const fast_big_integer exponent = fast_big_integer::extensions::random_sizeof(20);
+
+	ASSERT_EQ(small_table.table_size(), 16u * 15u);
+	ASSERT_EQ(small_table.pow(exponent), fast_big_integer::extensions::pow_mod(base, exponent, modulus));
+	ASSERT_TRUE(small_table.pow(fast_big_integer::zero()).is_one());
+
+	ASSERT_THROW(fast_big_integer::fixed_base_pow(base, modulus, 0), std::invalid_argument);
+	ASSERT_THROW(fast_big_integer::fixed_base_pow(base, modulus, fast_big_integer::fixed_base_pow::max_window_bits_count + 1), std::invalid_argument);
+}
+
+TEST(Extensions, MultiPowMod)
+{
+	for (const size_t count : { 0, 1, 2, 5, 40 })
+	{
+		// odd modulus (Montgomery) and even modulus
+		for (const fast_big_integer& modulus : { fast_big_integer::extensions::random_sizeof(40) | fast_big_integer::one(), fast_big_integer(1000) })
+		{
+			std::vector<fast_big_integer> bases, exponents;
+			fast_big_integer expected = fast_big_integer::one();
+
+			for (size_t i = 0; i < count; i++)
+			{
+				bases.push_back(fast_big_integer::extensions::random_sizeof(40));
+				exponents.push_back(fast_big_integer::extensions::random_sizeof(1 + i % 20));
+
+				expected = expected * fast_big_integer::extensions::pow_mod(bases.back(), exponents.back(), modulus) % modulus;
+			}
+
+			ASSERT_EQ(fast_big_integer::extensions::multi_pow_mod(bases, exponents, modulus), expected);
+		}
+	}
+}
+
+TEST(Arithmetic, BitwiseOperators)
+{
+	const fast_big_integer a = 0b1100;
+	const fast_big_integer b = 0b1010;
+
+	ASSERT_EQ(a & b, fast_big_integer(0b1000));
+	ASSERT_EQ(a | b, fast_big_integer(0b1110));
+	ASSERT_EQ(a ^ b, fast_big_integer(0b0110));
+}
+
+TEST(Conversion, ToStringDecimal)
+{
+	ASSERT_EQ(fast_big_integer::zero().to_string(), "0");
+	ASSERT_EQ(fast_big_integer(static_cast<uint64_t>(10'000'000'000'000'000'000ull)).to_string(), "10000000000000000000");
+	ASSERT_EQ(fast_big_integer::extensions::pow2(300).to_string(),
+		"2037035976334486086268445688409378161051468393665936250636140449354381299763336706183397376");
+
+	// zeros inside of number are kept by all halves
+	ASSERT_EQ(fast_big_integer(10).pow(100).to_string(), "1" + std::string(100, '0'));
+	ASSERT_EQ(fast_big_integer(10).pow(100).minus_one().to_string(), std::string(100, '9'));
+}
+
+TEST(Conversion, FromStringDecimal)
+{
+	const std::string digits = "1234567890123456789012345678901234567890123456789012345678901234567890";
+
+	ASSERT_EQ(fast_big_integer(digits).to_string(), digits);
+	ASSERT_EQ(fast_big_integer("000000000000000000000000042").to_string(), "42");
+	ASSERT_TRUE(fast_big_integer("0").is_zero());
+	ASSERT_EQ(fast_big_integer("1" + std::string(100, '0')), fast_big_integer(10).pow(100));
+
+	ASSERT_THROW(fast_big_integer(""), std::invalid_argument);
+	ASSERT_THROW(fast_big_integer("12345678901234:6789"), std::invalid_argument);
+	ASSERT_THROW(fast_big_integer("-1"), std::invalid_argument);
+}
+
+TEST(Conversion, RadixPowersCache)
+{
+	const fast_big_integer x = fast_big_integer(7).pow(1000);
+	const std::string digits = x.to_string();
+
+	ASSERT_GT(fast_big_integer::radix_powers_cache::memory_usage(), 0u);
+	ASSERT_EQ(*fast_big_integer::radix_powers_cache::power(10, 1), fast_big_integer(10).pow(38));
+
+	fast_big_integer::radix_powers_cache::clear();
+	ASSERT_EQ(fast_big_integer::radix_powers_cache::memory_usage(), 0u);
+
+	// powers over limit are calculated without caching
+	fast_big_integer::radix_powers_cache::set_memory_limit(0);
+	ASSERT_EQ(x.to_string(), digits);
+	ASSERT_EQ(fast_big_integer(digits), x);
+	ASSERT_EQ(fast_big_integer::radix_powers_cache::memory_usage(), 0u);
+
+	fast_big_integer::radix_powers_cache::set_memory_limit(fast_big_integer::radix_powers_cache::default_memory_limit);
+}
+
+TEST(Conversion, ToCharsFromChars)
+{
+	const fast_big_integer x = fast_big_integer(3).pow(150) + fast_big_integer(7);
+	const std::string hex = "359ba2b98ca11d6864a331b45ae7114c01ffbdcf60cc16e692fb63c6e220";
+	const std::string base36 = "y8rbmvxoscqxvtgs6yeud4eml1tk14eriui3n5fb1hh0kg";
+
+	char buffer[512];
+	for (const auto& [base, digits] : { std::pair<int, std::string>{ 16, hex }, { 36, base36 }, { 10, x.to_string() } })
+	{
+		ASSERT_GE(x.max_chars(base), digits.size());
+
+		const std::to_chars_result written = x.to_chars(buffer, buffer + sizeof(buffer), base);
+		ASSERT_EQ(written.ec, std::errc());
+		ASSERT_EQ(std::string(buffer, written.ptr), digits);
+
+		fast_big_integer value;
+		const std::from_chars_result read = fast_big_integer::from_chars(digits.data(), digits.data() + digits.size(), value, base);
+		ASSERT_EQ(read.ec, std::errc());
+		ASSERT_EQ(read.ptr, digits.data() + digits.size());
+		ASSERT_EQ(value, x);
+	}
+
+	// buffer must contain all digits
+	ASSERT_EQ(x.to_chars(buffer, buffer + hex.size() - 1, 16).ec, std::errc::value_too_large);
+	ASSERT_EQ(x.to_chars(buffer, buffer + 10, 10).ec, std::errc::value_too_large);
+
+	// parsing stops at the first char, which is not a digit of base
+	const std::string chars = "10Fg";
+	fast_big_integer value;
+	const std::from_chars_result read = fast_big_integer::from_chars(chars.data(), chars.data() + chars.size(), value, 16);
+	ASSERT_EQ(read.ptr, chars.data() + 3);
+	ASSERT_EQ(value, fast_big_integer(0x10F));
+
+	ASSERT_EQ(fast_big_integer::from_chars(chars.data(), chars.data() + chars.size(), value, 2).ptr, chars.data() + 2);
+	ASSERT_EQ(value, fast_big_integer(2));
+
+	ASSERT_EQ(fast_big_integer::from_chars(chars.data() + 3, chars.data() + 4, value, 16).ec, std::errc::invalid_argument);
+	ASSERT_EQ(value, fast_big_integer(2));
+
+	ASSERT_THROW(x.to_chars(buffer, buffer + sizeof(buffer), 37), std::invalid_argument);
+}
+
+TEST(Conversion, Hex)
+{
+	const std::string hex = "0123456789ABCDEFFEDCBA98765432100123456789ABCDEF0123456789abcdef";
+	const fast_big_integer x = fast_big_integer::extensions::create_from_hex(hex);
+
+	ASSERT_EQ(x.to_string_hex(), "0123456789ABCDEFFEDCBA98765432100123456789ABCDEF0123456789ABCDEF");
+	ASSERT_EQ(x.to_string_hex(false), "0123456789abcdeffedcba98765432100123456789abcdef0123456789abcdef");
+	ASSERT_EQ(x, fast_big_integer::extensions::create_from_hex(x.to_string_hex(false)));
+
+	// odd count of digits, leading zeros and zero
+	ASSERT_EQ(fast_big_integer::extensions::create_from_hex("abc"), fast_big_integer(0xABC));
+	ASSERT_EQ(fast_big_integer::extensions::create_from_hex("0000000000000000000000000000000000000001"), fast_big_integer(1));
+	ASSERT_EQ(fast_big_integer::zero().to_string_hex(), "00");
+
+	// invalid chars are found in vector and tail parts
+	ASSERT_THROW(fast_big_integer::extensions::create_from_hex(std::string(40, 'a') + "g"), std::invalid_argument);
+	ASSERT_THROW(fast_big_integer::extensions::create_from_hex(std::string(20, 'a') + ":" + std::string(20, 'a')), std::invalid_argument);
+	ASSERT_THROW(fast_big_integer::extensions::create_from_hex(std::string(20, 'a') + "\xC6" + std::string(20, 'a')), std::invalid_argument);
+}
+
+TEST(Conversion, ExportImport)
+{
+	const fast_big_integer x = fast_big_integer::extensions::create_from_hex("0102030405060708090A");
+
+	std::vector<std::byte> buffer(x.export_size(4));
+	ASSERT_EQ(buffer.size(), 12u);
+
+	// little endian words are bytes of number padded by zeros
+	ASSERT_EQ(x.export_to(buffer, std::endian::little, 4), 12u);
+	ASSERT_EQ(buffer[0], std::byte{ 0x0A });
+	ASSERT_EQ(buffer[9], std::byte{ 0x01 });
+	ASSERT_EQ(buffer[11], std::byte{ 0x00 });
+	ASSERT_EQ(fast_big_integer::import_from(buffer, std::endian::little, 4), x);
+
+	ASSERT_EQ(x.export_to(buffer, std::endian::big, 4), 12u);
+	ASSERT_EQ(buffer[0], std::byte{ 0x00 });
+	ASSERT_EQ(buffer[2], std::byte{ 0x01 });
+	ASSERT_EQ(buffer[11], std::byte{ 0x0A });
+	ASSERT_EQ(fast_big_integer::import_from(buffer, std::endian::big, 4), x);
+
+	ASSERT_THROW(x.export_to(std::span<std::byte>(buffer).first(8), std::endian::little, 4), std::invalid_argument);
+	ASSERT_THROW(fast_big_integer::import_from(std::span<const std::byte>(buffer).first(10), std::endian::little, 4), std::invalid_argument);
+	ASSERT_TRUE(fast_big_integer::import_from({}).is_zero());
+}
+
+TEST(Conversion, EncodeDecode)
+{
+	const std::vector<fast_big_integer> numbers = { fast_big_integer::zero(), fast_big_integer(255), fast_big_integer(3).pow(1000) };
+
+	size_t size = 0;
+	for (const fast_big_integer& number : numbers)
+		size += number.encoded_size();
+
+	// 3^1000 has 199 bytes, so its length prefix takes two bytes
+	ASSERT_EQ(size, 1u + 2u + 201u);
+
+	std::vector<std::byte> buffer(size);
+	size_t position = 0;
+	for (const fast_big_integer& number : numbers)
+		position += number.encode_to(std::span<std::byte>(buffer).subspan(position));
+
+	position = 0;
+	for (const fast_big_integer& number : numbers)
+	{
+		size_t read_bytes_count = 0;
+		ASSERT_EQ(fast_big_integer::decode_from(std::span<const std::byte>(buffer).subspan(position), read_bytes_count), number);
+		position += read_bytes_count;
+	}
+	ASSERT_EQ(position, buffer.size());
+
+	size_t read_bytes_count = 0;
+	ASSERT_THROW(fast_big_integer::decode_from(std::span<const std::byte>(buffer).subspan(3, 100), read_bytes_count), std::invalid_argument);
+
+	// the tenth prefix byte of 64 bit length may contain only one bit
+	std::vector<std::byte> oversized_prefix(9, std::byte{ 0x80 });
+	oversized_prefix.push_back(std::byte{ 0x02 });
+	ASSERT_THROW(fast_big_integer::decode_from(oversized_prefix, read_bytes_count), std::invalid_argument);
+}
+
+TEST(Conversion, SaveLoad)
+{
+	// unique name, so parallel runs of tests do not share file
+	const std::string path = (std::filesystem::temp_directory_path() / ("fast_big_integer_save_load_" + std::to_string(std::random_device()()) + ".bin")).string();
+	const fast_big_integer x = fast_big_integer(7).pow(10000);
+
+	x.save(path);
+	ASSERT_EQ(std::filesystem::file_size(path), 32u + x.to_bytes().size());
+	ASSERT_EQ(fast_big_integer::load(path), x);
+
+	{
+		const fast_big_integer::mapped_number mapped(path);
+		ASSERT_EQ(mapped.bytes().size(), x.to_bytes().size());
+		ASSERT_EQ(mapped.to_number(), x);
+	}
+
+	fast_big_integer::zero().save(path);
+	ASSERT_TRUE(fast_big_integer::load(path).is_zero());
+
+	// corrupted byte is found by checksum
+	x.save(path);
+	{
+		std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+		file.seekp(100);
+		file.put('\x5A');
+	}
+	ASSERT_THROW(fast_big_integer::load(path), std::invalid_argument);
+	ASSERT_THROW(fast_big_integer::mapped_number mapped(path), std::invalid_argument);
+
+	std::filesystem::remove(path);
+	ASSERT_THROW(fast_big_integer::load(path), std::invalid_argument);
+}
+
+TEST(Conversion, StreamOutput)
+{
+	const fast_big_integer x = fast_big_integer(7).pow(1000) + fast_big_integer(10).pow(500);
+
+	std::ostringstream stream;
+	stream << x << ' ' << fast_big_integer::zero();
+	ASSERT_EQ(stream.str(), x.to_string() + " 0");
+
+	// formatting flags
+	std::ostringstream formatted;
+	formatted << std::hex << fast_big_integer(0xABCDEF) << ' ' << std::uppercase << std::showbase << fast_big_integer(0xABCDEF) << ' '
+		<< std::oct << fast_big_integer(8) << ' ' << std::dec << std::setw(6) << std::setfill('*') << fast_big_integer(42) << ' '
+		<< std::left << std::setw(4) << fast_big_integer(7) << '|';
+	ASSERT_EQ(formatted.str(), "abcdef 0XABCDEF 010 ****42 7***|");
+
+	// nothing is written to failed stream
+	std::ostringstream failed;
+	failed.setstate(std::ios_base::failbit);
+	failed << x;
+	ASSERT_TRUE(failed.str().empty());
+
+	// all chunks except the last are full
+	for (const int base : { 10, 16, 36 })
+	{
+		std::string digits;
+		std::vector<size_t> chunk_sizes;
+
+		x.write_to([&](const std::string_view chunk)
+		{
+			digits += chunk;
+			chunk_sizes.push_back(chunk.size());
+		}, base, 7);
+
+		std::string expected(x.max_chars(base), '0');
+		expected.resize(static_cast<size_t>(x.to_chars(expected.data(), expected.data() + expected.size(), base).ptr - expected.data()));
+
+		ASSERT_EQ(digits, expected);
+		ASSERT_EQ(chunk_sizes.size(), (expected.size() + 6) / 7);
+		ASSERT_TRUE(std::all_of(chunk_sizes.begin(), chunk_sizes.end() - 1, [](const size_t size) { return size == 7; }));
+	}
+}
+
+TEST(Conversion, ParallelConversion)
+{
+	// low threshold forces splitting between threads of pool on any machine, it is restored on any exit from test
+	struct threshold_guard
+	{
+		size_t threshold = fast_big_integer::parallel_conversion_threshold();
+
+		~threshold_guard()
+		{
+			fast_big_integer::set_parallel_conversion_threshold(this->threshold);
+		}
+	} guard;
+	fast_big_integer::set_parallel_conversion_threshold(1000);
+
+	// digits count is greater then threshold of parallel conversion, so halves are converted by thread pool
+	const fast_big_integer x = fast_big_integer(7).pow(100'000) + fast_big_integer(10).pow(40'000);
+
+	const std::string digits = x.to_string();
+	ASSERT_EQ(digits.size(), 84'510u);
+
+	// sink receives digits from serial conversion
+	std::string streamed_digits;
+	x.write_to([&](const std::string_view chunk) { streamed_digits += chunk; });
+	ASSERT_EQ(digits, streamed_digits);
+
+	ASSERT_EQ(fast_big_integer(digits), x);
+
+	fast_big_integer value;
+	const std::string base36 = [&x]
+	{
+		std::string chars(x.max_chars(36), '0');
+		chars.resize(static_cast<size_t>(x.to_chars(chars.data(), chars.data() + chars.size(), 36).ptr - chars.data()));
+		return chars;
+	}();
+	fast_big_integer::from_chars(base36.data(), base36.data() + base36.size(), value, 36);
+	ASSERT_EQ(value, x);
+	ASSERT_EQ(value.to_string(), digits);
+}
+
+TEST(View, ReadOnlyOperations)
+{
+	const fast_big_integer x = fast_big_integer(3).pow(200);
+	const fast_big_integer y = fast_big_integer(2).pow(150).plus_one();
+
+	// external buffer with zero bytes at the end
+	std::vector<::numbers::byte> buffer = y.to_bytes();
+	buffer.resize(buffer.size() + 5);
+	const fast_big_integer_view y_view(buffer.data(), buffer.size());
+	const fast_big_integer_view x_view = x;
+
+	ASSERT_EQ(y_view.size(), y.to_bytes().size());
+	ASSERT_EQ(y_view.bit_length(), 151u);
+	ASSERT_TRUE(y_view.is_odd());
+	ASSERT_TRUE(fast_big_integer_view().is_zero());
+
+	ASSERT_TRUE(y_view == y);
+	ASSERT_TRUE(x == x_view);
+	ASSERT_TRUE(y_view < x_view);
+	ASSERT_TRUE(x > y_view);
+	ASSERT_TRUE(y_view != x);
+
+	ASSERT_EQ(y_view.hash(), y.hash());
+	ASSERT_EQ(std::hash<fast_big_integer_view>()(y_view), std::hash<fast_big_integer>()(y));
+	const std::unordered_set<fast_big_integer> numbers = { x, y };
+	ASSERT_EQ(numbers.count(y_view.to_number()), 1u);
+
+	ASSERT_EQ(y_view.to_string(), y.to_string());
+	ASSERT_EQ(y_view.to_number(), y);
+
+	// view as right operand
+	ASSERT_EQ(x + y_view, x + y);
+	ASSERT_EQ(x - y_view, x - y);
+	ASSERT_EQ(x * y_view, x * y);
+	ASSERT_EQ(x / y_view, x / y);
+	ASSERT_EQ(x % y_view, x % y);
+	ASSERT_EQ(x & y_view, x & y);
+	ASSERT_EQ(x | y_view, x | y);
+	ASSERT_EQ(x ^ y_view, x ^ y);
+	ASSERT_EQ(x_view ^ y_view, x ^ y);
+
+	fast_big_integer z = x;
+	z.add(y_view);
+	z.mul(y_view);
+	z.sub(y_view);
+	ASSERT_EQ(z, (x + y) * y - y);
+
+	// view of own bytes
+	fast_big_integer one = 1;
+	one.mul(fast_big_integer_view(one));
+	ASSERT_TRUE(one.is_one());
+}
+
 #endif
\ No newline at end of file